@@ -0,0 +1,175 @@
+/* 
+ * File:   ecu_alert_zone.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 03:30 PM
+ */
+
+#include "ecu_alert_zone.h"
+
+/* Zone entered at a distance (cm) , and zone held at that distance by a tracker already at it or above */
+#define ALERT_ZONE_ENTERED(_D)  (((_D) <= ALERT_ZONE_CRITICAL_ENTRY) ? ALERT_ZONE_CRITICAL :    \
+                                 ((_D) <= ALERT_ZONE_WARNING_ENTRY) ? ALERT_ZONE_WARNING :      \
+                                 ((_D) <= ALERT_ZONE_CAUTION_ENTRY) ? ALERT_ZONE_CAUTION : ALERT_ZONE_FAR)
+#define ALERT_ZONE_HELD(_D)     (((_D) <= ALERT_ZONE_CRITICAL_EXIT) ? ALERT_ZONE_CRITICAL :     \
+                                 ((_D) <= ALERT_ZONE_WARNING_EXIT) ? ALERT_ZONE_WARNING :       \
+                                 ((_D) <= ALERT_ZONE_CAUTION_EXIT) ? ALERT_ZONE_CAUTION : ALERT_ZONE_FAR)
+/* One lookup entry : held zone in the high nibble , entered zone in the low nibble */
+#define ALERT_ZONE_LUT_ENTRY(_D) ((uint8)(((uint8)ALERT_ZONE_HELD(_D) << 4) | (uint8)ALERT_ZONE_ENTERED(_D)))
+#define ALERT_ZONE_LUT_ROW(_D)   ALERT_ZONE_LUT_ENTRY((_D) + 0U) , ALERT_ZONE_LUT_ENTRY((_D) + 1U) ,         \
+                                 ALERT_ZONE_LUT_ENTRY((_D) + 2U) , ALERT_ZONE_LUT_ENTRY((_D) + 3U) ,         \
+                                 ALERT_ZONE_LUT_ENTRY((_D) + 4U) , ALERT_ZONE_LUT_ENTRY((_D) + 5U) ,         \
+                                 ALERT_ZONE_LUT_ENTRY((_D) + 6U) , ALERT_ZONE_LUT_ENTRY((_D) + 7U)
+
+/* Time-to-collision zones , three comparisons each */
+#define ALERT_ZONE_TTC_ENTERED(_T)  (((_T) <= ALERT_ZONE_CRITICAL_TTC_ENTRY) ? ALERT_ZONE_CRITICAL :   \
+                                     ((_T) <= ALERT_ZONE_WARNING_TTC_ENTRY) ? ALERT_ZONE_WARNING :     \
+                                     ((_T) <= ALERT_ZONE_CAUTION_TTC_ENTRY) ? ALERT_ZONE_CAUTION : ALERT_ZONE_FAR)
+#define ALERT_ZONE_TTC_HELD(_T)     (((_T) <= ALERT_ZONE_CRITICAL_TTC_EXIT) ? ALERT_ZONE_CRITICAL :    \
+                                     ((_T) <= ALERT_ZONE_WARNING_TTC_EXIT) ? ALERT_ZONE_WARNING :      \
+                                     ((_T) <= ALERT_ZONE_CAUTION_TTC_EXIT) ? ALERT_ZONE_CAUTION : ALERT_ZONE_FAR)
+
+#if ALERT_ZONE_LUT_SIZE != 64U
+#error "alert_zone_lut is generated for 64 distances"
+#endif
+
+/* Generated at build time from the zone bands , kept in program memory */
+static const uint8 alert_zone_lut[ALERT_ZONE_LUT_SIZE] = {
+    ALERT_ZONE_LUT_ROW(0U)  , ALERT_ZONE_LUT_ROW(8U)  , ALERT_ZONE_LUT_ROW(16U) , ALERT_ZONE_LUT_ROW(24U) ,
+    ALERT_ZONE_LUT_ROW(32U) , ALERT_ZONE_LUT_ROW(40U) , ALERT_ZONE_LUT_ROW(48U) , ALERT_ZONE_LUT_ROW(56U)
+};
+
+/* Indexed by alert_zone_id_t */
+static const alert_zone_profile_t alert_zone_profiles[ALERT_ZONE_COUNT] = {
+    {ALERT_ZONE_FAR_PROFILE},
+    {ALERT_ZONE_CAUTION_PROFILE},
+    {ALERT_ZONE_WARNING_PROFILE},
+    {ALERT_ZONE_CRITICAL_PROFILE}
+};
+
+static alert_zone_id_t alert_zone_hysteresis(alert_zone_id_t _current , alert_zone_id_t _entered , alert_zone_id_t _held);
+
+/**
+ * @brief Start in the far zone
+ * @param _zone pointer to the zone tracker
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType alert_zone_init(alert_zone_t *_zone){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _zone){
+        retVal = E_NOT_OK;
+    }
+    else{
+        _zone->zone = ALERT_ZONE_FAR;
+        _zone->distance_zone = ALERT_ZONE_FAR;
+        _zone->ttc_zone = ALERT_ZONE_FAR;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Classify a sample in constant time by its distance and its time-to-collision , a more
+ *        severe zone is entered at once and a zone is left only beyond its hysteresis band
+ * @param _zone pointer to the zone tracker
+ * @param _distance the measured distance (cm)
+ * @param _ttc_ms the predicted time-to-collision (ms) , 0xFFFF when the obstacle is not closing
+ * @param _changed 1 when the reported zone changed with this sample, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType alert_zone_update(alert_zone_t *_zone , uint16 _distance , uint16 _ttc_ms , uint8 *_changed){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_entry = (uint8)ALERT_ZONE_FAR;
+    alert_zone_id_t l_zone = ALERT_ZONE_FAR;
+    if((NULL == _zone) || (NULL == _changed)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        if(ALERT_ZONE_LUT_SIZE > _distance){
+            l_entry = alert_zone_lut[_distance];
+        }
+        else{ /* Nothing */ }
+        _zone->distance_zone = alert_zone_hysteresis(_zone->distance_zone , (alert_zone_id_t)(l_entry & 0x0FU) , 
+                                                     (alert_zone_id_t)(l_entry >> 4));
+        _zone->ttc_zone = alert_zone_hysteresis(_zone->ttc_zone , ALERT_ZONE_TTC_ENTERED(_ttc_ms) , ALERT_ZONE_TTC_HELD(_ttc_ms));
+        l_zone = (_zone->ttc_zone > _zone->distance_zone) ? _zone->ttc_zone : _zone->distance_zone;
+        *_changed = (l_zone != _zone->zone) ? 1 : 0;
+        _zone->zone = l_zone;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Read the outputs profile of the current zone
+ * @param _zone pointer to the zone tracker
+ * @param _profile pointer set to the profile of the current zone
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType alert_zone_get_profile(const alert_zone_t *_zone , const alert_zone_profile_t **_profile){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _zone) || (NULL == _profile) || (ALERT_ZONE_COUNT <= _zone->zone)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_profile = &alert_zone_profiles[_zone->zone];
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Compute the buzzer half-period of the current zone for a distance : (zone ms per cm) x distance ,
+ *        in 32 bits and bounded by the longest half-period of the zone , a 0 cm reading counts as 1 cm
+ * @param _zone pointer to the zone tracker
+ * @param _distance the measured distance (cm)
+ * @param _half_period_ms the buzzer half-period (ms) , 0 when the buzzer is off in the current zone
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType alert_zone_get_buzzer_half_period(const alert_zone_t *_zone , uint16 _distance , uint16 *_half_period_ms){
+    Std_ReturnType retVal = E_NOT_OK;
+    const alert_zone_profile_t *l_profile = NULL;
+    uint32 l_half_period = 0;
+    if((NULL == _zone) || (NULL == _half_period_ms) || (ALERT_ZONE_COUNT <= _zone->zone)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_profile = &alert_zone_profiles[_zone->zone];
+        if(0 == _distance){
+            _distance = 1;
+        }
+        else{ /* Nothing */ }
+        l_half_period = (uint32)_distance * l_profile->buzzer_ms_per_cm;
+        if(l_half_period > l_profile->buzzer_max_half_period_ms){
+            l_half_period = l_profile->buzzer_max_half_period_ms;
+        }
+        else{ /* Nothing */ }
+        *_half_period_ms = (uint16)l_half_period;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/*--------------------------------------Helper functions---------------------------------------*/
+
+/* Inside the hysteresis band of the current zone (or of one between) the tracker does not step down */
+static alert_zone_id_t alert_zone_hysteresis(alert_zone_id_t _current , alert_zone_id_t _entered , alert_zone_id_t _held){
+    alert_zone_id_t l_zone = _entered;
+    if(_held > _current){
+        _held = _current;
+    }
+    else{ /* Nothing */ }
+    if(_held > l_zone){
+        l_zone = _held;
+    }
+    else{ /* Nothing */ }
+    return l_zone;
+}
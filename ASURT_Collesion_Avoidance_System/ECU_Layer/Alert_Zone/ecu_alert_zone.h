@@ -0,0 +1,110 @@
+/* 
+ * File:   ecu_alert_zone.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 03:30 PM
+ */
+
+#ifndef ECU_ALERT_ZONE_H
+#define	ECU_ALERT_ZONE_H
+
+/****************************************Includes***************************************/
+
+#include "../../MCAL_Layer/mcal_std_types.h"
+#include "ecu_alert_zone_cfg.h"
+
+/***********************************Macro Declarations**********************************/
+
+/* Distances covered by the lookup table (cm) , every distance beyond it is in the far zone */
+#define ALERT_ZONE_LUT_SIZE             64U
+
+#if (ALERT_ZONE_CRITICAL_ENTRY > ALERT_ZONE_CRITICAL_EXIT) || (ALERT_ZONE_WARNING_ENTRY > ALERT_ZONE_WARNING_EXIT) \
+    || (ALERT_ZONE_CAUTION_ENTRY > ALERT_ZONE_CAUTION_EXIT)
+#error "An alert zone ENTRY distance is above its EXIT distance"
+#endif
+#if (ALERT_ZONE_CRITICAL_ENTRY >= ALERT_ZONE_WARNING_ENTRY) || (ALERT_ZONE_WARNING_ENTRY >= ALERT_ZONE_CAUTION_ENTRY) \
+    || (ALERT_ZONE_CRITICAL_EXIT >= ALERT_ZONE_WARNING_EXIT) || (ALERT_ZONE_WARNING_EXIT >= ALERT_ZONE_CAUTION_EXIT)
+#error "The alert zones must be nested : CRITICAL inside WARNING inside CAUTION"
+#endif
+#if (ALERT_ZONE_CRITICAL_TTC_ENTRY > ALERT_ZONE_CRITICAL_TTC_EXIT) || (ALERT_ZONE_WARNING_TTC_ENTRY > ALERT_ZONE_WARNING_TTC_EXIT) \
+    || (ALERT_ZONE_CAUTION_TTC_ENTRY > ALERT_ZONE_CAUTION_TTC_EXIT) || (ALERT_ZONE_CRITICAL_TTC_EXIT >= ALERT_ZONE_WARNING_TTC_EXIT) \
+    || (ALERT_ZONE_WARNING_TTC_EXIT >= ALERT_ZONE_CAUTION_TTC_EXIT) || (ALERT_ZONE_CRITICAL_TTC_ENTRY >= ALERT_ZONE_WARNING_TTC_ENTRY) \
+    || (ALERT_ZONE_WARNING_TTC_ENTRY >= ALERT_ZONE_CAUTION_TTC_ENTRY) || (ALERT_ZONE_CAUTION_TTC_EXIT >= 0xFFFFU)
+#error "The time-to-collision bands must be ordered and nested like the distance bands"
+#endif
+#if ALERT_ZONE_CAUTION_EXIT >= ALERT_ZONE_LUT_SIZE
+#error "ALERT_ZONE_CAUTION_EXIT must be below ALERT_ZONE_LUT_SIZE"
+#endif
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/* Ordered by severity */
+typedef enum{
+    ALERT_ZONE_FAR = 0,
+    ALERT_ZONE_CAUTION,
+    ALERT_ZONE_WARNING,
+    ALERT_ZONE_CRITICAL,
+    ALERT_ZONE_COUNT
+}alert_zone_id_t;
+
+/* Outputs of one zone, the table lives in program memory */
+typedef struct{
+    uint16 led_period_ms;               /* LED toggle period , 0 : LED off */
+    uint8 buzzer_ms_per_cm;             /* buzzer half-period per cm of distance , 0 : buzzer off */
+    uint16 buzzer_max_half_period_ms;   /* bound of the buzzer half-period , must not be 0 with the buzzer on */
+    uint32 tone_hz;                     /* buzzer PWM tone , 0 : plain output */
+}alert_zone_profile_t;
+
+typedef struct{
+    alert_zone_id_t zone;               /* reported zone , the most severe of the two below */
+    alert_zone_id_t distance_zone;      /* zone of the distance , hysteresis applied */
+    alert_zone_id_t ttc_zone;           /* zone of the time-to-collision , hysteresis applied */
+}alert_zone_t;
+
+/***********************************Function Declarations*******************************/
+
+/**
+ * @brief Start in the far zone
+ * @param _zone pointer to the zone tracker
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType alert_zone_init(alert_zone_t *_zone);
+/**
+ * @brief Classify a sample in constant time by its distance and its time-to-collision , a more
+ *        severe zone is entered at once and a zone is left only beyond its hysteresis band
+ * @param _zone pointer to the zone tracker
+ * @param _distance the measured distance (cm)
+ * @param _ttc_ms the predicted time-to-collision (ms) , 0xFFFF when the obstacle is not closing
+ * @param _changed 1 when the reported zone changed with this sample, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType alert_zone_update(alert_zone_t *_zone , uint16 _distance , uint16 _ttc_ms , uint8 *_changed);
+/**
+ * @brief Read the outputs profile of the current zone
+ * @param _zone pointer to the zone tracker
+ * @param _profile pointer set to the profile of the current zone
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType alert_zone_get_profile(const alert_zone_t *_zone , const alert_zone_profile_t **_profile);
+/**
+ * @brief Compute the buzzer half-period of the current zone for a distance : (zone ms per cm) x distance ,
+ *        in 32 bits and bounded by the longest half-period of the zone , a 0 cm reading counts as 1 cm
+ * @param _zone pointer to the zone tracker
+ * @param _distance the measured distance (cm)
+ * @param _half_period_ms the buzzer half-period (ms) , 0 when the buzzer is off in the current zone
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType alert_zone_get_buzzer_half_period(const alert_zone_t *_zone , uint16 _distance , uint16 *_half_period_ms);
+
+#endif	/* ECU_ALERT_ZONE_H */
+
@@ -0,0 +1,55 @@
+/* 
+ * File:   ecu_alert_zone_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 03:30 PM
+ */
+
+#ifndef ECU_ALERT_ZONE_CFG_H
+#define	ECU_ALERT_ZONE_CFG_H
+
+/****************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* 
+ * Zone bands (cm) : a zone is entered at or below its ENTRY distance and left only above its
+ * EXIT distance , ENTRY <= EXIT and each zone nested inside the one before it
+ */
+#define ALERT_ZONE_CAUTION_ENTRY        50U
+#define ALERT_ZONE_CAUTION_EXIT         53U
+#define ALERT_ZONE_WARNING_ENTRY        30U
+#define ALERT_ZONE_WARNING_EXIT         33U
+#define ALERT_ZONE_CRITICAL_ENTRY       15U
+#define ALERT_ZONE_CRITICAL_EXIT        18U
+
+/* 
+ * Time-to-collision bands (ms) : a zone is also entered at or below its TTC ENTRY and held up to its
+ * TTC EXIT , the most severe of the distance zone and the TTC zone is reported
+ */
+#define ALERT_ZONE_CAUTION_TTC_ENTRY    3000U
+#define ALERT_ZONE_CAUTION_TTC_EXIT     3500U
+#define ALERT_ZONE_WARNING_TTC_ENTRY    2000U
+#define ALERT_ZONE_WARNING_TTC_EXIT     2400U
+#define ALERT_ZONE_CRITICAL_TTC_ENTRY   1000U
+#define ALERT_ZONE_CRITICAL_TTC_EXIT    1300U
+
+/* 
+ * Zone profiles : LED toggle period (ms , 0 : off) , buzzer half-period per cm of distance
+ * (ms , 0 : off) , longest buzzer half-period (ms) , buzzer PWM tone (Hz , 0 : buzzer driven as
+ * a plain output). The longest half-period is the cadence at the EXIT distance of the zone : a zone
+ * entered on its time-to-collision far beyond its band never beeps slower than its band edge
+ */
+#define ALERT_ZONE_FAR_PROFILE          0U   , 0U  , 0U                                    , 0UL
+#define ALERT_ZONE_CAUTION_PROFILE      500U , 10U , (10U * ALERT_ZONE_CAUTION_EXIT)       , 2000UL
+#define ALERT_ZONE_WARNING_PROFILE      250U , 10U , (10U * ALERT_ZONE_WARNING_EXIT)       , 3000UL
+#define ALERT_ZONE_CRITICAL_PROFILE     125U , 10U , (10U * ALERT_ZONE_CRITICAL_EXIT)      , 4000UL
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* ECU_ALERT_ZONE_CFG_H */
+
@@ -0,0 +1,134 @@
+/* 
+ * File:   ecu_event_queue.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 11:40 AM
+ */
+
+#include "ecu_event_queue.h"
+
+/**
+ * @brief Empty the queue and clear its dropped events counter
+ * @param _queue pointer to the event queue
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType event_queue_init(event_queue_t *_queue){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _queue){
+        retVal = E_NOT_OK;
+    }
+    else{
+        _queue->head = 0;
+        _queue->tail = 0;
+        _queue->dropped = 0;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Post one event record, called by the producer (interrupt context)
+ * @param _queue pointer to the event queue
+ * @param _id the event identifier
+ * @param _data the event payload
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (queue full , event dropped)
+ */
+Std_ReturnType event_queue_post(event_queue_t *_queue, uint8 _id, uint16 _data){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_head = 0;
+    if(NULL == _queue){
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_head = _queue->head;
+        if(EVENT_QUEUE_SIZE == (uint8)(l_head - _queue->tail)){
+            if(0xFFU != _queue->dropped){
+                _queue->dropped++;
+            }
+            else{ /* Nothing */ }
+            retVal = E_NOT_OK;
+        }
+        else{
+            /* The record is complete before head publishes it to the consumer */
+            _queue->events[l_head & EVENT_QUEUE_INDEX_MASK].id = _id;
+            _queue->events[l_head & EVENT_QUEUE_INDEX_MASK].data = _data;
+            _queue->head = (uint8)(l_head + 1U);
+            retVal = E_OK;
+        }
+    }
+    return retVal;
+}
+
+/**
+ * @brief Take the oldest event record, called by the consumer (main loop)
+ * @param _queue pointer to the event queue
+ * @param _event the event record taken from the queue
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (queue empty)
+ */
+Std_ReturnType event_queue_get(event_queue_t *_queue, event_t *_event){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_tail = 0;
+    if((NULL == _queue) || (NULL == _event)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_tail = _queue->tail;
+        if(l_tail == _queue->head){
+            retVal = E_NOT_OK;
+        }
+        else{
+            /* The record is copied out before tail hands the slot back to the producer */
+            _event->id = _queue->events[l_tail & EVENT_QUEUE_INDEX_MASK].id;
+            _event->data = _queue->events[l_tail & EVENT_QUEUE_INDEX_MASK].data;
+            _queue->tail = (uint8)(l_tail + 1U);
+            retVal = E_OK;
+        }
+    }
+    return retVal;
+}
+
+/**
+ * @brief Check whether the queue holds no event , called by the consumer (main loop)
+ * @param _queue pointer to the event queue
+ * @param _empty 1 when the queue is empty , 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType event_queue_is_empty(const event_queue_t *_queue, uint8 *_empty){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _queue) || (NULL == _empty)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_empty = (uint8)((_queue->tail == _queue->head) ? 1U : 0U);
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Read the number of events dropped because the queue was full
+ * @param _queue pointer to the event queue
+ * @param _dropped the dropped events counter
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType event_queue_get_dropped(const event_queue_t *_queue, uint8 *_dropped){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _queue) || (NULL == _dropped)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_dropped = _queue->dropped;
+        retVal = E_OK;
+    }
+    return retVal;
+}
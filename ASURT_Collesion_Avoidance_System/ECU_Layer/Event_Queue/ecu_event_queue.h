@@ -0,0 +1,94 @@
+/* 
+ * File:   ecu_event_queue.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 11:40 AM
+ */
+
+#ifndef ECU_EVENT_QUEUE_H
+#define	ECU_EVENT_QUEUE_H
+
+/****************************************Includes***************************************/
+
+#include "../../MCAL_Layer/mcal_std_types.h"
+#include "ecu_event_queue_cfg.h"
+
+/***********************************Macro Declarations**********************************/
+
+#if (0U == EVENT_QUEUE_SIZE) || (0U != (EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1U))) || (128U < EVENT_QUEUE_SIZE)
+#error "EVENT_QUEUE_SIZE must be a power of two between 1 and 128"
+#endif
+
+#define EVENT_QUEUE_INDEX_MASK          (EVENT_QUEUE_SIZE - 1U)
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+typedef struct{
+    uint8 id;                           /* application defined event identifier */
+    uint16 data;                        /* optional payload captured by the producer */
+}event_t;
+
+/*
+ * Lock-free single-producer / single-consumer queue : head is only written by the producer
+ * (one interrupt priority level) and tail only by the consumer (the main loop).
+ * head and tail are free running 8-bit counters so their single byte writes are atomic.
+ */
+typedef struct{
+    event_t events[EVENT_QUEUE_SIZE];
+    volatile uint8 head;
+    volatile uint8 tail;
+    volatile uint8 dropped;             /* events lost because the queue was full, saturates at 0xFF */
+}event_queue_t;
+
+/***********************************Function Declarations*******************************/
+
+/**
+ * @brief Empty the queue and clear its dropped events counter
+ * @param _queue pointer to the event queue
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType event_queue_init(event_queue_t *_queue);
+/**
+ * @brief Post one event record, called by the producer (interrupt context)
+ * @param _queue pointer to the event queue
+ * @param _id the event identifier
+ * @param _data the event payload
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (queue full , event dropped)
+ */
+Std_ReturnType event_queue_post(event_queue_t *_queue, uint8 _id, uint16 _data);
+/**
+ * @brief Take the oldest event record, called by the consumer (main loop)
+ * @param _queue pointer to the event queue
+ * @param _event the event record taken from the queue
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (queue empty)
+ */
+Std_ReturnType event_queue_get(event_queue_t *_queue, event_t *_event);
+/**
+ * @brief Check whether the queue holds no event , called by the consumer (main loop)
+ * @param _queue pointer to the event queue
+ * @param _empty 1 when the queue is empty , 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType event_queue_is_empty(const event_queue_t *_queue, uint8 *_empty);
+/**
+ * @brief Read the number of events dropped because the queue was full
+ * @param _queue pointer to the event queue
+ * @param _dropped the dropped events counter
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType event_queue_get_dropped(const event_queue_t *_queue, uint8 *_dropped);
+
+#endif	/* ECU_EVENT_QUEUE_H */
+
@@ -0,0 +1,25 @@
+/* 
+ * File:   ecu_event_queue_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 11:40 AM
+ */
+
+#ifndef ECU_EVENT_QUEUE_CFG_H
+#define	ECU_EVENT_QUEUE_CFG_H
+
+/****************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* Event records held by one queue, must be a power of two not larger than 128 */
+#define EVENT_QUEUE_SIZE                8U
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* ECU_EVENT_QUEUE_CFG_H */
+
@@ -0,0 +1,212 @@
+/* 
+ * File:   ecu_link_frame.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 10:12 AM
+ */
+
+#include "ecu_link_frame.h"
+
+/* CRC-8 polynomial 0x07 lookup table, const so it is placed in program memory */
+static const uint8 link_frame_crc8_table[256] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+    0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+    0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+    0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+    0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+    0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+    0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+    0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+    0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+    0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+    0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
+};
+
+static uint8 link_frame_parser_step(link_frame_parser_t *_parser , uint8 _byte , link_frame_t *_frame , uint8 *_frame_ready);
+
+/**
+ * @brief Reset the parser state machine and its counters
+ * @param _parser pointer to the parser object
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_frame_parser_init(link_frame_parser_t *_parser){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_index = 0;
+    if(NULL == _parser){
+        retVal = E_NOT_OK;
+    }
+    else{
+        _parser->state = LINK_FRAME_WAIT_SYNC;
+        _parser->crc = LINK_FRAME_CRC_INIT;
+        _parser->frame.sequence = 0;
+        _parser->frame.distance = 0;
+        _parser->frame.flags = 0;
+        for(l_index = 0 ; l_index < LINK_FRAME_LENGTH ; l_index++){
+            _parser->raw[l_index] = 0;
+        }
+        _parser->expected_sequence = 0;
+        _parser->sequence_valid = 0;
+        _parser->frames_ok = 0;
+        _parser->crc_errors = 0;
+        _parser->sequence_gaps = 0;
+        _parser->bytes_discarded = 0;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Feed one received byte to the parser, bounded time per byte
+ * @note A CRC error rescans the bytes of the bad frame from its first SYNC byte after the start,
+ *       at most LINK_FRAME_LENGTH - 1 extra steps, so a SYNC value inside the payload does not hide a frame
+ * @param _parser pointer to the parser object
+ * @param _byte the received byte
+ * @param _frame the decoded frame, written only when a frame is completed
+ * @param _frame_ready set to 1 when a valid frame was completed by this byte, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_frame_parser_feed(link_frame_parser_t *_parser , uint8 _byte , link_frame_t *_frame , uint8 *_frame_ready){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_raw[LINK_FRAME_LENGTH];
+    uint8 l_start = 0;
+    uint8 l_index = 0;
+    if((NULL == _parser) || (NULL == _frame) || (NULL == _frame_ready)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_frame_ready = 0;
+        if(1 == link_frame_parser_step(_parser , _byte , _frame , _frame_ready)){
+            /* The bad frame may hide the start of the next one : restart from the first SYNC byte after
+               the discarded SYNC. Fewer than LINK_FRAME_LENGTH bytes are replayed, they cannot complete
+               (nor fail) a frame, the parser is only left in the state the real frame has reached */
+            for(l_index = 0 ; l_index < LINK_FRAME_LENGTH ; l_index++){
+                l_raw[l_index] = _parser->raw[l_index];
+            }
+            l_start = LINK_FRAME_SEQUENCE_INDEX;
+            while((l_start < LINK_FRAME_LENGTH) && (LINK_FRAME_SYNC_BYTE != l_raw[l_start])){
+                l_start++;
+            }
+            for(l_index = l_start ; l_index < LINK_FRAME_LENGTH ; l_index++){
+                (void)link_frame_parser_step(_parser , l_raw[l_index] , _frame , _frame_ready);
+            }
+        }
+        else{ /* Nothing */ }
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Advance the parser state machine by one byte
+ * @param _parser pointer to the parser object
+ * @param _byte the received byte
+ * @param _frame the decoded frame, written only when a frame is completed
+ * @param _frame_ready set to 1 when a valid frame was completed by this byte
+ * @return 1 when the byte was the CRC of a corrupted frame, 0 otherwise
+ */
+static uint8 link_frame_parser_step(link_frame_parser_t *_parser , uint8 _byte , link_frame_t *_frame , uint8 *_frame_ready){
+    uint8 l_crc_error = 0;
+    _parser->raw[_parser->state] = _byte;
+    switch(_parser->state){
+        case LINK_FRAME_WAIT_SYNC :
+            if(LINK_FRAME_SYNC_BYTE == _byte){
+                _parser->crc = LINK_FRAME_CRC_INIT;
+                _parser->state = LINK_FRAME_WAIT_SEQUENCE;
+            }
+            else{
+                _parser->bytes_discarded++;
+            }
+            break;
+        case LINK_FRAME_WAIT_SEQUENCE :
+            _parser->frame.sequence = _byte;
+            _parser->crc = link_frame_crc8_table[_parser->crc ^ _byte];
+            _parser->state = LINK_FRAME_WAIT_DISTANCE_LOW;
+            break;
+        case LINK_FRAME_WAIT_DISTANCE_LOW :
+            _parser->frame.distance = _byte;
+            _parser->crc = link_frame_crc8_table[_parser->crc ^ _byte];
+            _parser->state = LINK_FRAME_WAIT_DISTANCE_HIGH;
+            break;
+        case LINK_FRAME_WAIT_DISTANCE_HIGH :
+            _parser->frame.distance |= (uint16)((uint16)_byte << 8);
+            _parser->crc = link_frame_crc8_table[_parser->crc ^ _byte];
+            _parser->state = LINK_FRAME_WAIT_FLAGS;
+            break;
+        case LINK_FRAME_WAIT_FLAGS :
+            _parser->frame.flags = _byte;
+            _parser->crc = link_frame_crc8_table[_parser->crc ^ _byte];
+            _parser->state = LINK_FRAME_WAIT_CRC;
+            break;
+        case LINK_FRAME_WAIT_CRC :
+            if(_parser->crc == _byte){
+                if((1 == _parser->sequence_valid) && (_parser->expected_sequence != _parser->frame.sequence)){
+                    _parser->sequence_gaps++;
+                }
+                else{ /* Nothing */ }
+                _parser->expected_sequence = (uint8)(_parser->frame.sequence + 1U);
+                _parser->sequence_valid = 1;
+                _parser->frames_ok++;
+                *_frame = _parser->frame;
+                *_frame_ready = 1;
+            }
+            else{
+                _parser->crc_errors++;
+                l_crc_error = 1;
+            }
+            _parser->state = LINK_FRAME_WAIT_SYNC;
+            break;
+        default :
+            _parser->state = LINK_FRAME_WAIT_SYNC;
+            break;
+    }
+    return l_crc_error;
+}
+
+/**
+ * @brief Encode a frame into a buffer of LINK_FRAME_LENGTH bytes
+ * @param _frame pointer to the frame to be encoded
+ * @param _buffer pointer to the output buffer
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_frame_encode(const link_frame_t *_frame , uint8 *_buffer){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_crc = LINK_FRAME_CRC_INIT;
+    uint8 l_counter = 0;
+    if((NULL == _frame) || (NULL == _buffer)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        _buffer[LINK_FRAME_SYNC_INDEX] = LINK_FRAME_SYNC_BYTE;
+        _buffer[LINK_FRAME_SEQUENCE_INDEX] = _frame->sequence;
+        _buffer[LINK_FRAME_DISTANCE_LOW_INDEX] = (uint8)(_frame->distance & 0xFFU);
+        _buffer[LINK_FRAME_DISTANCE_HIGH_INDEX] = (uint8)(_frame->distance >> 8);
+        _buffer[LINK_FRAME_FLAGS_INDEX] = _frame->flags;
+        for(l_counter = LINK_FRAME_SEQUENCE_INDEX ; l_counter < LINK_FRAME_CRC_INDEX ; l_counter++){
+            l_crc = link_frame_crc8_table[l_crc ^ _buffer[l_counter]];
+        }
+        _buffer[LINK_FRAME_CRC_INDEX] = l_crc;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Update a CRC-8 (polynomial 0x07) with one byte using a ROM table
+ * @param _crc the running CRC
+ * @param _byte the next byte
+ * @return the updated CRC
+ */
+uint8 link_frame_crc8_update(uint8 _crc , uint8 _byte){
+    return link_frame_crc8_table[_crc ^ _byte];
+}
@@ -0,0 +1,108 @@
+/* 
+ * File:   ecu_link_frame.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 10:12 AM
+ */
+
+#ifndef ECU_LINK_FRAME_H
+#define	ECU_LINK_FRAME_H
+
+/****************************************Includes***************************************/
+
+#include "../../MCAL_Layer/mcal_std_types.h"
+#include "ecu_link_frame_cfg.h"
+
+/***********************************Macro Declarations**********************************/
+
+/* Frame layout : SYNC | SEQ | DIST_L | DIST_H | FLAGS | CRC8 */
+#define LINK_FRAME_LENGTH               6U
+
+#define LINK_FRAME_SYNC_INDEX           0U
+#define LINK_FRAME_SEQUENCE_INDEX       1U
+#define LINK_FRAME_DISTANCE_LOW_INDEX   2U
+#define LINK_FRAME_DISTANCE_HIGH_INDEX  3U
+#define LINK_FRAME_FLAGS_INDEX          4U
+#define LINK_FRAME_CRC_INDEX            5U
+
+/* The sensor had no echo, the distance field is not a measurement */
+#define LINK_FRAME_FLAG_NO_ECHO         0x01U
+/* Control frame, the distance field carries a command for the link layer */
+#define LINK_FRAME_FLAG_CONTROL         0x80U
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/* Each state is numbered with the frame index of the byte it waits for */
+typedef enum{
+    LINK_FRAME_WAIT_SYNC = 0,
+    LINK_FRAME_WAIT_SEQUENCE,
+    LINK_FRAME_WAIT_DISTANCE_LOW,
+    LINK_FRAME_WAIT_DISTANCE_HIGH,
+    LINK_FRAME_WAIT_FLAGS,
+    LINK_FRAME_WAIT_CRC
+}link_frame_state_t;
+
+typedef struct{
+    uint8 sequence;
+    uint16 distance;
+    uint8 flags;
+}link_frame_t;
+
+typedef struct{
+    link_frame_state_t state;
+    uint8 crc;
+    link_frame_t frame;                 /* frame under assembly */
+    uint8 raw[LINK_FRAME_LENGTH];       /* bytes of the frame under assembly, rescanned after a CRC error */
+    uint8 expected_sequence;
+    uint8 sequence_valid    : 1;        /* at least one frame was accepted */
+    uint8 reserved          : 7;
+    uint16 frames_ok;
+    uint16 crc_errors;
+    uint16 sequence_gaps;               /* accepted frames whose SEQ was not the expected one */
+    uint16 bytes_discarded;             /* bytes dropped while hunting for the SYNC byte */
+}link_frame_parser_t;
+
+/***********************************Function Declarations*******************************/
+
+/**
+ * @brief Reset the parser state machine and its counters
+ * @param _parser pointer to the parser object
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_frame_parser_init(link_frame_parser_t *_parser);
+/**
+ * @brief Feed one received byte to the parser, bounded time per byte
+ * @note A CRC error rescans the bytes of the bad frame from its first SYNC byte after the start,
+ *       at most LINK_FRAME_LENGTH - 1 extra steps, so a SYNC value inside the payload does not hide a frame
+ * @param _parser pointer to the parser object
+ * @param _byte the received byte
+ * @param _frame the decoded frame, written only when a frame is completed
+ * @param _frame_ready set to 1 when a valid frame was completed by this byte, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_frame_parser_feed(link_frame_parser_t *_parser , uint8 _byte , link_frame_t *_frame , uint8 *_frame_ready);
+/**
+ * @brief Encode a frame into a buffer of LINK_FRAME_LENGTH bytes
+ * @param _frame pointer to the frame to be encoded
+ * @param _buffer pointer to the output buffer
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_frame_encode(const link_frame_t *_frame , uint8 *_buffer);
+/**
+ * @brief Update a CRC-8 (polynomial 0x07) with one byte using a ROM table
+ * @param _crc the running CRC
+ * @param _byte the next byte
+ * @return the updated CRC
+ */
+uint8 link_frame_crc8_update(uint8 _crc , uint8 _byte);
+
+#endif	/* ECU_LINK_FRAME_H */
+
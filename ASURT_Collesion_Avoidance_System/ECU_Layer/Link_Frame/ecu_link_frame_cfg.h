@@ -0,0 +1,27 @@
+/* 
+ * File:   ecu_link_frame_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 10:12 AM
+ */
+
+#ifndef ECU_LINK_FRAME_CFG_H
+#define	ECU_LINK_FRAME_CFG_H
+
+/****************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* First byte of every frame, the parser hunts for it after any error */
+#define LINK_FRAME_SYNC_BYTE            0xA5U
+/* Initial value of the CRC-8 (polynomial 0x07) computed over SEQ .. FLAGS */
+#define LINK_FRAME_CRC_INIT             0x00U
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* ECU_LINK_FRAME_CFG_H */
+
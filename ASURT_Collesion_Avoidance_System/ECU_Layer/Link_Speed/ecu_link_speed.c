@@ -0,0 +1,383 @@
+/* 
+ * File:   ecu_link_speed.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 11:05 AM
+ */
+
+#include "ecu_link_speed.h"
+
+#if LINK_SPEED_RATE_0 != EUSART_ASYNC_BAUDRATE
+#error "LINK_SPEED_RATE_0 must be the EUSART_ASYNC_BAUDRATE both nodes boot with"
+#endif
+#if (EUSART_BRG_BEST_ERROR(LINK_SPEED_RATE_1) > EUSART_BAUDRATE_ERROR_TOLERANCE) || \
+    (EUSART_BRG_BEST_ERROR(LINK_SPEED_RATE_2) > EUSART_BAUDRATE_ERROR_TOLERANCE) || \
+    (EUSART_BRG_BEST_ERROR(LINK_SPEED_RATE_3) > EUSART_BAUDRATE_ERROR_TOLERANCE)
+#error "A LINK_SPEED_RATE_x cannot be generated from _XTAL_FREQ within EUSART_BAUDRATE_ERROR_TOLERANCE"
+#endif
+#if (LINK_SPEED_RECOVERY_PERIODS << LINK_SPEED_RECOVERY_MAX_SHIFT) > 0xFFFFUL
+#error "The longest recovery window does not fit the uint16 clean_periods counter"
+#endif
+
+/* SPBRGH:SPBRG the auto-baud measurement (BRG16 = 1 , BRGH = 1) gives for the 0x55 sent at LINK_SPEED_RATE_0,
+   and the deviation accepted from it (EUSART_BAUDRATE_ERROR_TOLERANCE plus one count of quantization) */
+#define LINK_SPEED_AUTO_BAUD_BRG        EUSART_BRG_VALUE(LINK_SPEED_RATE_0 , 4UL)
+#define LINK_SPEED_AUTO_BAUD_MARGIN     (((LINK_SPEED_AUTO_BAUD_BRG * EUSART_BAUDRATE_ERROR_TOLERANCE) / 1000UL) + 1UL)
+
+/* BRG settings of every negotiable rate, computed at compile time */
+static const link_speed_rate_t link_speed_rates[LINK_SPEED_RATE_COUNT] = {
+    {EUSART_BRG_BEST_MODE(LINK_SPEED_RATE_0) , EUSART_BRG_BEST_VALUE(LINK_SPEED_RATE_0)},
+    {EUSART_BRG_BEST_MODE(LINK_SPEED_RATE_1) , EUSART_BRG_BEST_VALUE(LINK_SPEED_RATE_1)},
+    {EUSART_BRG_BEST_MODE(LINK_SPEED_RATE_2) , EUSART_BRG_BEST_VALUE(LINK_SPEED_RATE_2)},
+    {EUSART_BRG_BEST_MODE(LINK_SPEED_RATE_3) , EUSART_BRG_BEST_VALUE(LINK_SPEED_RATE_3)}
+};
+
+static Std_ReturnType link_speed_send(link_speed_t *_link , uint8 _command , uint8 _rate_index);
+static Std_ReturnType link_speed_apply(link_speed_t *_link , uint8 _rate_index);
+static Std_ReturnType link_speed_fall_back(link_speed_t *_link);
+static void link_speed_recovery(link_speed_t *_link , uint16 _link_errors);
+static Std_ReturnType link_speed_auto_baud_check(link_speed_t *_link);
+
+/**
+ * @brief Initialize the link speed negotiation, the responder arms the auto-baud detection
+ * @param _link pointer to the link speed object
+ * @param _eusart pointer to the EUSART the link runs on
+ * @param _parser pointer to the frame parser fed from that EUSART, used for its CRC error count
+ * @param _role LINK_SPEED_INITIATOR or LINK_SPEED_RESPONDER
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_speed_init(link_speed_t *_link , const eusart_t *_eusart , const link_frame_parser_t *_parser , link_speed_role_t _role){
+    Std_ReturnType retVal = E_NOT_OK;
+    eusart_error_counters_t l_counters = {0};
+    if((NULL == _link) || (NULL == _eusart) || (NULL == _parser)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        _link->eusart = _eusart;
+        _link->parser = _parser;
+        _link->role = _role;
+        _link->state = LINK_SPEED_AUTO_BAUD;
+        _link->rate_index = 0;
+        _link->rate_target = 0;
+        _link->rate_limit = LINK_SPEED_RATE_COUNT - 1U;
+        _link->timer = 0;
+        _link->sequence = 0;
+        _link->crc_errors_seen = _parser->crc_errors;
+        retVal = EUSART_ASYNC_Get_Error_Counters(_eusart , &l_counters);
+        _link->framing_errors_seen = l_counters.framing_errors;
+        _link->fallbacks = 0;
+        _link->clean_periods = 0;
+        _link->recovery_shift = 0;
+        _link->auto_baud_rejects = 0;
+        if(LINK_SPEED_RESPONDER == _role){
+            retVal = EUSART_ASYNC_Auto_Baud_Start(_eusart);
+        }
+        else{
+            retVal = E_OK;
+        }
+    }
+    return retVal;
+}
+
+/**
+ * @brief Run the negotiation timeouts and the error supervision, to be called periodically
+ * @param _link pointer to the link speed object
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_speed_periodic(link_speed_t *_link){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint16 l_link_errors = 0;
+    eusart_error_counters_t l_counters = {0};
+    uint8 l_auto_baud = EUSART_AUTO_BAUD_IDLE;
+    uint8 l_tx_free = 0;
+    const uint8 l_sync_char = LINK_SPEED_AUTO_BAUD_CHAR;
+    if(NULL == _link){
+        retVal = E_NOT_OK;
+    }
+    else{
+        retVal = E_OK;
+        if(_link->timer < 0xFF){
+            _link->timer++;
+        }
+        else{ /* Nothing */ }
+        /* Corrupted frames and characters with a bad stop bit since the last period */
+        retVal = EUSART_ASYNC_Get_Error_Counters(_link->eusart , &l_counters);
+        l_link_errors = (uint16)(_link->parser->crc_errors - _link->crc_errors_seen) +
+                        (uint16)(l_counters.framing_errors - _link->framing_errors_seen);
+        _link->crc_errors_seen = _link->parser->crc_errors;
+        _link->framing_errors_seen = l_counters.framing_errors;
+
+        switch(_link->state){
+            case LINK_SPEED_AUTO_BAUD :
+                if(LINK_SPEED_INITIATOR == _link->role){
+                    /* Keep offering the measurement character until the responder answers */
+                    retVal = EUSART_ASYNC_Write_Buffer_Async(_link->eusart , &l_sync_char , 1 , NULL);
+                }
+                else{
+                    retVal = EUSART_ASYNC_Auto_Baud_Status(_link->eusart , &l_auto_baud);
+                    if(EUSART_AUTO_BAUD_DONE == l_auto_baud){
+                        retVal = link_speed_auto_baud_check(_link);
+                    }
+                    else if(EUSART_AUTO_BAUD_OVERFLOW == l_auto_baud){
+                        retVal = EUSART_ASYNC_Auto_Baud_Start(_link->eusart);
+                    }
+                    else{ /* Nothing */ }
+                }
+                break;
+            case LINK_SPEED_SAFE :
+            case LINK_SPEED_RUNNING :
+                if((_link->timer >= LINK_SPEED_SILENCE_TIMEOUT) || (l_link_errors >= LINK_SPEED_ERROR_THRESHOLD)){
+                    retVal = link_speed_fall_back(_link);
+                }
+                else if(LINK_SPEED_RESPONDER == _link->role){
+                    link_speed_recovery(_link , l_link_errors);
+                    retVal = link_speed_send(_link , LINK_SPEED_CMD_STATUS , _link->rate_index);
+                }
+                else{
+                    link_speed_recovery(_link , l_link_errors);
+                    /* Also from RUNNING : re-probe upward once rate_limit was raised again */
+                    if(_link->rate_limit > _link->rate_index){
+                        _link->rate_target = _link->rate_limit;
+                        retVal = link_speed_send(_link , LINK_SPEED_CMD_REQUEST , _link->rate_target);
+                    }
+                    else{ /* Nothing */ }
+                }
+                break;
+            case LINK_SPEED_SWITCH_PENDING :
+                /* Switch only once the ACK left the transmit queue */
+                retVal = EUSART_ASYNC_Tx_Queue_Free(_link->eusart , &l_tx_free);
+                if((E_OK == retVal) && (EUSART_TX_QUEUE_SIZE == l_tx_free)){
+                    retVal = link_speed_apply(_link , _link->rate_target);
+                    _link->state = LINK_SPEED_VERIFY;
+                    _link->timer = 0;
+                }
+                else if(_link->timer >= LINK_SPEED_RESPONSE_TIMEOUT){
+                    _link->state = LINK_SPEED_SAFE;
+                    _link->timer = 0;
+                }
+                else{ /* Nothing */ }
+                break;
+            case LINK_SPEED_VERIFY :
+                if(_link->timer >= LINK_SPEED_RESPONSE_TIMEOUT){
+                    retVal = link_speed_fall_back(_link);
+                }
+                else{
+                    retVal = link_speed_send(_link , LINK_SPEED_CMD_STATUS , _link->rate_index);
+                }
+                break;
+            default :
+                retVal = link_speed_fall_back(_link);
+                break;
+        }
+    }
+    return retVal;
+}
+
+/**
+ * @brief Give every valid received frame to the negotiation
+ * @param _link pointer to the link speed object
+ * @param _frame pointer to the received frame
+ * @param _consumed set to 1 when the frame was a control frame, 0 when it carries a distance
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_speed_frame_received(link_speed_t *_link , const link_frame_t *_frame , uint8 *_consumed){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_command = 0;
+    uint8 l_rate_index = 0;
+    if((NULL == _link) || (NULL == _frame) || (NULL == _consumed)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        retVal = E_OK;
+        /* Any valid frame proves the current rate works */
+        _link->timer = 0;
+        if(LINK_SPEED_AUTO_BAUD == _link->state){
+            _link->state = LINK_SPEED_SAFE;
+        }
+        else if(LINK_SPEED_VERIFY == _link->state){
+            _link->state = LINK_SPEED_RUNNING;
+        }
+        else{ /* Nothing */ }
+
+        if(LINK_FRAME_FLAG_CONTROL == (_frame->flags & LINK_FRAME_FLAG_CONTROL)){
+            *_consumed = 1;
+            l_command = (uint8)(_frame->distance >> 8);
+            l_rate_index = (uint8)(_frame->distance & 0xFFU);
+            if((LINK_SPEED_CMD_REQUEST == l_command) && (LINK_SPEED_RESPONDER == _link->role) &&
+               ((LINK_SPEED_SAFE == _link->state) || (LINK_SPEED_RUNNING == _link->state)) &&
+               (l_rate_index < LINK_SPEED_RATE_COUNT)){
+                _link->rate_target = l_rate_index;
+                _link->state = LINK_SPEED_SWITCH_PENDING;
+                _link->timer = 0;
+                retVal = link_speed_send(_link , LINK_SPEED_CMD_ACK , l_rate_index);
+            }
+            else if((LINK_SPEED_CMD_ACK == l_command) && (LINK_SPEED_INITIATOR == _link->role) &&
+                    ((LINK_SPEED_SAFE == _link->state) || (LINK_SPEED_RUNNING == _link->state)) &&
+                    (l_rate_index == _link->rate_target) && (l_rate_index != _link->rate_index)){
+                /* The ACK is fully received, the responder switches right after it */
+                retVal = link_speed_apply(_link , l_rate_index);
+                _link->state = LINK_SPEED_VERIFY;
+            }
+            else{ /* Nothing */ }
+        }
+        else{
+            *_consumed = 0;
+        }
+    }
+    return retVal;
+}
+
+/**
+ * @brief Queue a distance frame numbered in the same sequence as the control frames
+ * @param _link pointer to the link speed object
+ * @param _distance the distance field
+ * @param _flags the flags field (LINK_FRAME_FLAG_CONTROL is cleared)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (auto-baud running or no room in the transmit queue)
+ */
+Std_ReturnType link_speed_send_data(link_speed_t *_link , uint16 _distance , uint8 _flags){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_buffer[LINK_FRAME_LENGTH];
+    link_frame_t l_frame;
+    if(NULL == _link){
+        retVal = E_NOT_OK;
+    }
+    else if(LINK_SPEED_AUTO_BAUD == _link->state){
+        /* The responder is measuring the sync character , a frame would corrupt the measurement */
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_frame.sequence = _link->sequence;
+        l_frame.distance = _distance;
+        l_frame.flags = (uint8)(_flags & (uint8)(~LINK_FRAME_FLAG_CONTROL));
+        retVal = link_frame_encode(&l_frame , l_buffer);
+        if(E_OK == retVal){
+            retVal = EUSART_ASYNC_Write_Buffer_Async(_link->eusart , l_buffer , LINK_FRAME_LENGTH , NULL);
+        }
+        else{ /* Nothing */ }
+        /* A frame that did not fit is not numbered , the receiver sees no sequence gap for it */
+        if(E_OK == retVal){
+            _link->sequence++;
+        }
+        else{ /* Nothing */ }
+    }
+    return retVal;
+}
+
+/*--------------------------------- Helper Functions --------------------------------------*/
+
+static Std_ReturnType link_speed_send(link_speed_t *_link , uint8 _command , uint8 _rate_index){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_buffer[LINK_FRAME_LENGTH];
+    link_frame_t l_frame = {
+        .sequence = _link->sequence,
+        .distance = (uint16)(((uint16)_command << 8) | _rate_index),
+        .flags = LINK_FRAME_FLAG_CONTROL
+    };
+    retVal = link_frame_encode(&l_frame , l_buffer);
+    if(E_OK == retVal){
+        retVal = EUSART_ASYNC_Write_Buffer_Async(_link->eusart , l_buffer , LINK_FRAME_LENGTH , NULL);
+    }
+    else{ /* Nothing */ }
+    /* Numbered like link_speed_send_data() : a frame that did not fit leaves no sequence gap */
+    if(E_OK == retVal){
+        _link->sequence++;
+    }
+    else{ /* Nothing */ }
+    return retVal;
+}
+
+static Std_ReturnType link_speed_apply(link_speed_t *_link , uint8 _rate_index){
+    Std_ReturnType retVal = E_NOT_OK;
+    retVal = EUSART_ASYNC_Set_Baud_Rate(_link->eusart , link_speed_rates[_rate_index].baudrate_config ,
+                                        link_speed_rates[_rate_index].brg_value);
+    _link->rate_index = _rate_index;
+    return retVal;
+}
+
+static Std_ReturnType link_speed_fall_back(link_speed_t *_link){
+    Std_ReturnType retVal = E_NOT_OK;
+    _link->fallbacks++;
+    _link->timer = 0;
+    /* Wait longer before every new attempt at the rate that failed */
+    _link->clean_periods = 0;
+    if(_link->recovery_shift < LINK_SPEED_RECOVERY_MAX_SHIFT){
+        _link->recovery_shift++;
+    }
+    else{ /* Nothing */ }
+    if(_link->rate_index > 0){
+        /* Do not retry the rate that failed, renegotiate from the safe rate */
+        if(_link->rate_index <= _link->rate_limit){
+            _link->rate_limit = _link->rate_index - 1U;
+        }
+        else{ /* Nothing */ }
+        retVal = link_speed_apply(_link , 0);
+        _link->state = LINK_SPEED_SAFE;
+    }
+    else{
+        /* Lost at the safe rate as well, resynchronize from scratch */
+        _link->state = LINK_SPEED_AUTO_BAUD;
+        if(LINK_SPEED_RESPONDER == _link->role){
+            retVal = EUSART_ASYNC_Auto_Baud_Start(_link->eusart);
+        }
+        else{
+            retVal = E_OK;
+        }
+    }
+    return retVal;
+}
+
+static void link_speed_recovery(link_speed_t *_link , uint16 _link_errors){
+    if(_link_errors > 0){
+        _link->clean_periods = 0;
+    }
+    else if(_link->rate_limit < (LINK_SPEED_RATE_COUNT - 1U)){
+        if(_link->clean_periods < ((uint16)LINK_SPEED_RECOVERY_PERIODS << _link->recovery_shift)){
+            _link->clean_periods++;
+        }
+        else{
+            /* The disturbance that lowered the limit may be gone , offer the next rate again */
+            _link->rate_limit++;
+            _link->clean_periods = 0;
+        }
+    }
+    else if(_link->clean_periods < LINK_SPEED_RECOVERY_PERIODS){
+        _link->clean_periods++;
+    }
+    else{
+        /* Stable with every rate offered , the next failure starts from the shortest window */
+        _link->recovery_shift = 0;
+    }
+}
+
+static Std_ReturnType link_speed_auto_baud_check(link_speed_t *_link){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint16 l_brg_value = 0;
+    retVal = EUSART_ASYNC_Auto_Baud_Get_Brg(_link->eusart , &l_brg_value);
+    if((E_OK == retVal) &&
+       ((uint32)l_brg_value + LINK_SPEED_AUTO_BAUD_MARGIN >= LINK_SPEED_AUTO_BAUD_BRG) &&
+       ((uint32)l_brg_value <= LINK_SPEED_AUTO_BAUD_BRG + LINK_SPEED_AUTO_BAUD_MARGIN)){
+        /* The measured rate is the safe rate , run it from the rate table rather than the measurement */
+        retVal = link_speed_apply(_link , 0);
+        _link->state = LINK_SPEED_SAFE;
+        _link->timer = 0;
+        retVal = link_speed_send(_link , LINK_SPEED_CMD_STATUS , _link->rate_index);
+    }
+    else{
+        /* Measured on a character of a frame the initiator still sends at another rate , not on its 0x55 */
+        if(_link->auto_baud_rejects < 0xFFFF){
+            _link->auto_baud_rejects++;
+        }
+        else{ /* Nothing */ }
+        retVal = link_speed_apply(_link , 0);
+        retVal = EUSART_ASYNC_Auto_Baud_Start(_link->eusart);
+    }
+    return retVal;
+}
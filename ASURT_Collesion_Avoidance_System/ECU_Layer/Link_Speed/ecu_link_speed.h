@@ -0,0 +1,111 @@
+/* 
+ * File:   ecu_link_speed.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 11:05 AM
+ */
+
+#ifndef ECU_LINK_SPEED_H
+#define	ECU_LINK_SPEED_H
+
+/****************************************Includes***************************************/
+
+#include "../../MCAL_Layer/EUSART/hal_eusart.h"
+#include "../Link_Frame/ecu_link_frame.h"
+#include "ecu_link_speed_cfg.h"
+
+/***********************************Macro Declarations**********************************/
+
+/* Character sent by the initiator while the responder measures the baud rate */
+#define LINK_SPEED_AUTO_BAUD_CHAR       0x55U
+
+/* Control commands : high byte of the distance field of a LINK_FRAME_FLAG_CONTROL frame,
+   the low byte carries the rate index */
+#define LINK_SPEED_CMD_REQUEST          0x01U   /* initiator asks for a rate */
+#define LINK_SPEED_CMD_ACK              0x02U   /* responder accepts it and switches after the ACK */
+#define LINK_SPEED_CMD_STATUS           0x03U   /* keep-alive carrying the rate in use */
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+typedef enum{
+    LINK_SPEED_INITIATOR = 0,
+    LINK_SPEED_RESPONDER
+}link_speed_role_t;
+
+typedef enum{
+    LINK_SPEED_AUTO_BAUD = 0,       /* initiator sends 0x55, responder measures it with ABDEN */
+    LINK_SPEED_SAFE,                /* synchronized at the safe rate, the initiator asks for a faster one */
+    LINK_SPEED_SWITCH_PENDING,      /* responder : ACK queued, switch once it left the transmitter */
+    LINK_SPEED_VERIFY,              /* new rate set, waiting for the first valid frame */
+    LINK_SPEED_RUNNING
+}link_speed_state_t;
+
+typedef struct{
+    baudrate_gen_t baudrate_config;
+    uint16 brg_value;
+}link_speed_rate_t;
+
+typedef struct{
+    const eusart_t *eusart;
+    const link_frame_parser_t *parser;
+    link_speed_role_t role;
+    link_speed_state_t state;
+    uint8 rate_index;               /* rate in use */
+    uint8 rate_target;              /* rate being negotiated */
+    uint8 rate_limit;               /* highest rate still worth trying, lowered after a failure and raised after clean operation */
+    uint8 timer;                    /* periods since the last state change or valid frame */
+    uint8 sequence;
+    uint16 crc_errors_seen;
+    uint16 framing_errors_seen;
+    uint16 fallbacks;
+    uint16 clean_periods;           /* error free periods since the last fall back or rate_limit change */
+    uint8 recovery_shift;           /* recovery window is LINK_SPEED_RECOVERY_PERIODS << recovery_shift */
+    uint16 auto_baud_rejects;       /* auto-baud measurements that did not match LINK_SPEED_RATE_0 */
+}link_speed_t;
+
+/***********************************Function Declarations*******************************/
+
+/**
+ * @brief Initialize the link speed negotiation, the responder arms the auto-baud detection
+ * @param _link pointer to the link speed object
+ * @param _eusart pointer to the EUSART the link runs on
+ * @param _parser pointer to the frame parser fed from that EUSART, used for its CRC error count
+ * @param _role LINK_SPEED_INITIATOR or LINK_SPEED_RESPONDER
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_speed_init(link_speed_t *_link , const eusart_t *_eusart , const link_frame_parser_t *_parser , link_speed_role_t _role);
+/**
+ * @brief Run the negotiation timeouts and the error supervision, to be called periodically
+ * @param _link pointer to the link speed object
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_speed_periodic(link_speed_t *_link);
+/**
+ * @brief Give every valid received frame to the negotiation
+ * @param _link pointer to the link speed object
+ * @param _frame pointer to the received frame
+ * @param _consumed set to 1 when the frame was a control frame, 0 when it carries a distance
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_speed_frame_received(link_speed_t *_link , const link_frame_t *_frame , uint8 *_consumed);
+/**
+ * @brief Queue a distance frame numbered in the same sequence as the control frames
+ * @param _link pointer to the link speed object
+ * @param _distance the distance field
+ * @param _flags the flags field (LINK_FRAME_FLAG_CONTROL is cleared)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (auto-baud running or no room in the transmit queue)
+ */
+Std_ReturnType link_speed_send_data(link_speed_t *_link , uint16 _distance , uint8 _flags);
+
+#endif	/* ECU_LINK_SPEED_H */
+
@@ -0,0 +1,40 @@
+/* 
+ * File:   ecu_link_speed_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 11:05 AM
+ */
+
+#ifndef ECU_LINK_SPEED_CFG_H
+#define	ECU_LINK_SPEED_CFG_H
+
+/****************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* Negotiable rates in increasing order, index 0 is the safe rate both nodes boot with.
+   115200 is not listed : its best BRG error at 8 MHz is 2.1 % */
+#define LINK_SPEED_RATE_0               9600UL
+#define LINK_SPEED_RATE_1               19200UL
+#define LINK_SPEED_RATE_2               38400UL
+#define LINK_SPEED_RATE_3               57600UL
+#define LINK_SPEED_RATE_COUNT           4U
+
+/* Timeouts are counted in link_speed_periodic() calls */
+#define LINK_SPEED_RESPONSE_TIMEOUT     4U      /* no answer to a rate change */
+#define LINK_SPEED_SILENCE_TIMEOUT      6U      /* no valid frame at all */
+/* CRC plus framing errors within one period that make the link fall back */
+#define LINK_SPEED_ERROR_THRESHOLD      3U
+/* Error free periods before a rate lowered by a fall back is tried again (60 x 500 ms = 30 s),
+   the window doubles after every fall back up to LINK_SPEED_RECOVERY_MAX_SHIFT times */
+#define LINK_SPEED_RECOVERY_PERIODS     60U
+#define LINK_SPEED_RECOVERY_MAX_SHIFT   3U
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* ECU_LINK_SPEED_CFG_H */
+
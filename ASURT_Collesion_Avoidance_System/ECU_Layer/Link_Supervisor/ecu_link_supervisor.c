@@ -0,0 +1,126 @@
+/* 
+ * File:   ecu_link_supervisor.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 05:00 PM
+ */
+
+#include "ecu_link_supervisor.h"
+
+/**
+ * @brief Reset the supervisor and its outage statistics , the silence is measured from now
+ * @param _supervisor pointer to the supervisor
+ * @param _now the current tick
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_supervisor_init(link_supervisor_t *_supervisor , uint16 _now){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _supervisor){
+        retVal = E_NOT_OK;
+    }
+    else{
+        _supervisor->last_frame_tick = _now;
+        _supervisor->last_check_tick = _now;
+        _supervisor->silence = 0;
+        _supervisor->last_outage = 0;
+        _supervisor->longest_outage = 0;
+        _supervisor->outages = 0;
+        _supervisor->stale = 0;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Timestamp a valid frame , a stale link recovers and its outage length is recorded
+ * @param _supervisor pointer to the supervisor
+ * @param _now the current tick
+ * @param _recovered 1 when this frame ended an outage, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_supervisor_frame_received(link_supervisor_t *_supervisor , uint16 _now , uint8 *_recovered){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _supervisor) || (NULL == _recovered)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_recovered = 0;
+        if(1 == _supervisor->stale){
+            /* The outage lasted from the last frame to this one */
+            _supervisor->last_outage = _supervisor->silence + (uint16)(_now - _supervisor->last_check_tick);
+            if(_supervisor->last_outage > _supervisor->longest_outage){
+                _supervisor->longest_outage = _supervisor->last_outage;
+            }
+            else{ /* Nothing */ }
+            _supervisor->stale = 0;
+            *_recovered = 1;
+        }
+        else{ /* Nothing */ }
+        _supervisor->last_frame_tick = _now;
+        _supervisor->last_check_tick = _now;
+        _supervisor->silence = 0;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Accumulate the silence and declare the link stale after LINK_SUPERVISOR_TIMEOUT ,
+ *        must be called more often than every 32767 ticks
+ * @param _supervisor pointer to the supervisor
+ * @param _now the current tick
+ * @param _went_stale 1 when the link was declared stale by this call, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_supervisor_periodic(link_supervisor_t *_supervisor , uint16 _now , uint8 *_went_stale){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _supervisor) || (NULL == _went_stale)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_went_stale = 0;
+        /* Saturates instead of wrapping during an outage of more than 49 days at 1 ms */
+        if(0xFFFF0000UL > _supervisor->silence){
+            _supervisor->silence += (uint16)(_now - _supervisor->last_check_tick);
+        }
+        else{ /* Nothing */ }
+        _supervisor->last_check_tick = _now;
+        if((0 == _supervisor->stale) && (LINK_SUPERVISOR_TIMEOUT <= _supervisor->silence)){
+            _supervisor->stale = 1;
+            if(0xFFFFU > _supervisor->outages){
+                _supervisor->outages++;
+            }
+            else{ /* Nothing */ }
+            *_went_stale = 1;
+        }
+        else{ /* Nothing */ }
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Read whether the link is stale
+ * @param _supervisor pointer to the supervisor
+ * @param _stale 1 while the link is stale, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_supervisor_is_stale(const link_supervisor_t *_supervisor , uint8 *_stale){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _supervisor) || (NULL == _stale)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_stale = _supervisor->stale;
+        retVal = E_OK;
+    }
+    return retVal;
+}
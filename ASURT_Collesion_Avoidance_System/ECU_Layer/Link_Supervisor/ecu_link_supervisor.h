@@ -0,0 +1,85 @@
+/* 
+ * File:   ecu_link_supervisor.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 05:00 PM
+ */
+
+#ifndef ECU_LINK_SUPERVISOR_H
+#define	ECU_LINK_SUPERVISOR_H
+
+/****************************************Includes***************************************/
+
+#include "../../MCAL_Layer/mcal_std_types.h"
+#include "ecu_link_supervisor_cfg.h"
+
+/***********************************Macro Declarations**********************************/
+
+#if (0U == LINK_SUPERVISOR_TIMEOUT) || (0x8000U <= LINK_SUPERVISOR_TIMEOUT)
+#error "LINK_SUPERVISOR_TIMEOUT must be between 1 and 32767 ticks"
+#endif
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/*
+ * Link staleness supervisor : every valid frame is timestamped , the silence since the last one
+ * is accumulated by the periodic check so outages longer than the 16-bit tick are measured too.
+ * The link starts stale-pending : without any frame it goes stale one timeout after init.
+ */
+typedef struct{
+    uint16 last_frame_tick;             /* tick of the last valid frame */
+    uint16 last_check_tick;             /* tick of the last periodic check */
+    uint32 silence;                     /* ticks since the last valid frame */
+    uint32 last_outage;                 /* length of the last finished outage (ticks) */
+    uint32 longest_outage;              /* longest finished outage (ticks) */
+    uint16 outages;                     /* outages declared since init */
+    uint8 stale     : 1;                /* no valid frame for LINK_SUPERVISOR_TIMEOUT */
+    uint8 reserved  : 7;
+}link_supervisor_t;
+
+/***********************************Function Declarations*******************************/
+
+/**
+ * @brief Reset the supervisor and its outage statistics , the silence is measured from now
+ * @param _supervisor pointer to the supervisor
+ * @param _now the current tick
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_supervisor_init(link_supervisor_t *_supervisor , uint16 _now);
+/**
+ * @brief Timestamp a valid frame , a stale link recovers and its outage length is recorded
+ * @param _supervisor pointer to the supervisor
+ * @param _now the current tick
+ * @param _recovered 1 when this frame ended an outage, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_supervisor_frame_received(link_supervisor_t *_supervisor , uint16 _now , uint8 *_recovered);
+/**
+ * @brief Accumulate the silence and declare the link stale after LINK_SUPERVISOR_TIMEOUT ,
+ *        must be called more often than every 32767 ticks
+ * @param _supervisor pointer to the supervisor
+ * @param _now the current tick
+ * @param _went_stale 1 when the link was declared stale by this call, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_supervisor_periodic(link_supervisor_t *_supervisor , uint16 _now , uint8 *_went_stale);
+/**
+ * @brief Read whether the link is stale
+ * @param _supervisor pointer to the supervisor
+ * @param _stale 1 while the link is stale, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType link_supervisor_is_stale(const link_supervisor_t *_supervisor , uint8 *_stale);
+
+#endif	/* ECU_LINK_SUPERVISOR_H */
+
@@ -0,0 +1,25 @@
+/* 
+ * File:   ecu_link_supervisor_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 05:00 PM
+ */
+
+#ifndef ECU_LINK_SUPERVISOR_CFG_H
+#define	ECU_LINK_SUPERVISOR_CFG_H
+
+/****************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* Silence (ticks , ms with the scheduler tick) after which the link is declared stale */
+#define LINK_SUPERVISOR_TIMEOUT         1000U
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* ECU_LINK_SUPERVISOR_CFG_H */
+
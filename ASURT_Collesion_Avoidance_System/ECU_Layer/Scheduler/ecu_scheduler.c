@@ -0,0 +1,205 @@
+/* 
+ * File:   ecu_scheduler.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 12:20 PM
+ */
+
+#include "ecu_scheduler.h"
+
+/* Longest execution (in ticks) that still fits the 16-bit Timer0 counts statistics */
+#define SCHEDULER_MAX_MEASURED_TICKS    ((uint16)((0xFFFFU / SCHEDULER_TICK_TIMER_COUNTS) - 1U))
+
+/* Incremented by the Timer0 interrupt, read by the main loop */
+static volatile uint16 scheduler_ticks = 0;
+static const timer0_t *scheduler_timer = NULL;
+static const scheduler_task_t *scheduler_tasks = NULL;
+static uint8 scheduler_task_count = 0;
+static scheduler_task_stats_t scheduler_stats[SCHEDULER_MAX_TASKS];
+
+static uint16 scheduler_read_ticks(void);
+static void scheduler_timestamp(uint16 *_tick , uint16 *_counts);
+
+/**
+ * @brief Install the task table and clear the tick counter and the task statistics
+ * @param _timer pointer to the Timer0 configurations driving the tick (16-bit timer mode), its period is
+ *        set to SCHEDULER_TICK_PERIOD_US and it is read for the execution times
+ * @param _tasks pointer to the task table, must stay valid while the scheduler runs
+ * @param _task_count number of entries in the task table (SCHEDULER_MAX_TASKS at most)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType scheduler_init(const timer0_t *_timer , const scheduler_task_t *_tasks , uint8 _task_count){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_index = 0;
+    if((NULL == _timer) || (NULL == _tasks) || (0 == _task_count) || (SCHEDULER_MAX_TASKS < _task_count)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        retVal = E_OK;
+        for(l_index = 0 ; l_index < _task_count ; l_index++){
+            if((NULL == _tasks[l_index].task) || (0 == _tasks[l_index].period_ms)){
+                retVal = E_NOT_OK;
+            }
+            else{ /* Nothing */ }
+        }
+        if(E_OK == retVal){
+            /* The tick period is owned by the scheduler , the Timer0 configurations only set the mode */
+            retVal = timer0_set_period_us(_timer , SCHEDULER_TICK_PERIOD_US);
+        }
+        else{ /* Nothing */ }
+        if(E_OK == retVal){
+            /* The tick is written by the Timer0 ISR, keep the 16-bit reset atomic */
+            TIMER0_InterruptDisable();
+            scheduler_ticks = 0;
+            TIMER0_InterruptEnable();
+            scheduler_timer = _timer;
+            scheduler_tasks = _tasks;
+            scheduler_task_count = _task_count;
+            for(l_index = 0 ; l_index < _task_count ; l_index++){
+                scheduler_stats[l_index].next_release = _tasks[l_index].offset_ms;
+                scheduler_stats[l_index].runs = 0;
+                scheduler_stats[l_index].overruns = 0;
+                scheduler_stats[l_index].last_execution = 0;
+                scheduler_stats[l_index].max_execution = 0;
+            }
+        }
+        else{ /* Nothing */ }
+    }
+    return retVal;
+}
+
+/**
+ * @brief Advance the system tick, called from the Timer0 interrupt handler
+ */
+void scheduler_tick(void){
+    scheduler_ticks++;
+}
+
+/**
+ * @brief Run every task whose release time has come, called from the main loop
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (scheduler not initialized)
+ */
+Std_ReturnType scheduler_dispatch(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_index = 0;
+    uint16 l_now = 0;
+    uint16 l_late = 0;
+    uint16 l_missed = 0;
+    uint16 l_start_tick = 0 , l_start_counts = 0;
+    uint16 l_end_tick = 0 , l_end_counts = 0;
+    uint16 l_execution = 0;
+    scheduler_task_stats_t *l_stats = NULL;
+    if(NULL == scheduler_tasks){
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_now = scheduler_read_ticks();
+        for(l_index = 0 ; l_index < scheduler_task_count ; l_index++){
+            l_stats = &scheduler_stats[l_index];
+            /* Wrap-safe : the release is due when it is not in the future */
+            if(0 <= (sint16)(l_now - l_stats->next_release)){
+                l_late = (uint16)(l_now - l_stats->next_release);
+                /* Started a full period late or more : the releases in between are dropped, not queued */
+                if(l_late >= scheduler_tasks[l_index].period_ms){
+                    l_missed = l_late / scheduler_tasks[l_index].period_ms;
+                    l_stats->next_release += (uint16)(l_missed * scheduler_tasks[l_index].period_ms);
+                    if((uint16)(0xFFFFU - l_stats->overruns) < l_missed){
+                        l_stats->overruns = 0xFFFFU;
+                    }
+                    else{
+                        l_stats->overruns += l_missed;
+                    }
+                }
+                else{ /* Nothing */ }
+                l_stats->next_release += scheduler_tasks[l_index].period_ms;
+
+                scheduler_timestamp(&l_start_tick , &l_start_counts);
+                scheduler_tasks[l_index].task();
+                scheduler_timestamp(&l_end_tick , &l_end_counts);
+
+                if((uint16)(l_end_tick - l_start_tick) > SCHEDULER_MAX_MEASURED_TICKS){
+                    l_execution = 0xFFFFU;
+                }
+                else{
+                    l_execution = (uint16)(((uint16)(l_end_tick - l_start_tick) * SCHEDULER_TICK_TIMER_COUNTS) 
+                                            + l_end_counts - l_start_counts);
+                }
+                l_stats->last_execution = l_execution;
+                if(l_execution > l_stats->max_execution){
+                    l_stats->max_execution = l_execution;
+                }
+                else{ /* Nothing */ }
+                l_stats->runs++;
+            }
+            else{ /* Nothing */ }
+        }
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Read the current system tick
+ * @param _ticks the number of ticks since scheduler_init() , wraps around
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType scheduler_get_ticks(uint16 *_ticks){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _ticks){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_ticks = scheduler_read_ticks();
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Read the run time statistics of one task
+ * @param _task_index index of the task in the task table
+ * @param _stats copy of the task statistics
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType scheduler_get_task_stats(uint8 _task_index , scheduler_task_stats_t *_stats){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _stats) || (_task_index >= scheduler_task_count)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_stats = scheduler_stats[_task_index];
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/*--------------------------------------Helper functions---------------------------------------*/
+
+/* The 16-bit tick is read twice until both reads match so a tick in the middle cannot tear it */
+static uint16 scheduler_read_ticks(void){
+    uint16 l_ticks = 0;
+    do{
+        l_ticks = scheduler_ticks;
+    }while(l_ticks != scheduler_ticks);
+    return l_ticks;
+}
+
+/* Tick and Timer0 counts into that tick, sampled consistently */
+static void scheduler_timestamp(uint16 *_tick , uint16 *_counts){
+    uint16 l_tick = 0;
+    uint16 l_timer = 0;
+    do{
+        l_tick = scheduler_ticks;
+        (void)timer0_read_value(scheduler_timer , &l_timer);
+    }while(l_tick != scheduler_ticks);
+    *_tick = l_tick;
+    *_counts = (uint16)(l_timer - SCHEDULER_TIMER0_PRELOAD);
+}
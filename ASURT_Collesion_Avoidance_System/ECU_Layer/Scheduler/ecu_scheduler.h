@@ -0,0 +1,90 @@
+/* 
+ * File:   ecu_scheduler.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 12:20 PM
+ */
+
+#ifndef ECU_SCHEDULER_H
+#define	ECU_SCHEDULER_H
+
+/****************************************Includes***************************************/
+
+#include "../../MCAL_Layer/Timer0/hal_timer0.h"
+#include "ecu_scheduler_cfg.h"
+
+/***********************************Macro Declarations**********************************/
+
+/* Timer0 counts per tick, Timer0 is clocked by FOSC/4 with the prescaler disabled */
+#define SCHEDULER_TICK_TIMER_COUNTS     ((uint16)TIMER0_PERIOD_CYCLES(SCHEDULER_TICK_PERIOD_US))
+/* Timer0 preload giving one overflow per tick */
+#define SCHEDULER_TIMER0_PRELOAD        TIMER0_PERIOD_PRELOAD(SCHEDULER_TICK_PERIOD_US)
+
+#if !TIMER0_PERIOD_IN_RANGE(SCHEDULER_TICK_PERIOD_US) || (TIMER0_PERIOD_PRESCALE(SCHEDULER_TICK_PERIOD_US) != 1UL) \
+    || (TIMER0_PERIOD_CYCLES(SCHEDULER_TICK_PERIOD_US) > 65535UL)
+#error "SCHEDULER_TICK_PERIOD_US does not fit the 16-bit Timer0 without a prescaler"
+#endif
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/* One entry of the (const) task table */
+typedef struct{
+    void (* task)(void);                /* run to completion from the main loop */
+    uint16 period_ms;                   /* release period in ticks, must not be 0 */
+    uint16 offset_ms;                   /* first release , spreads tasks of the same period */
+}scheduler_task_t;
+
+/* Run time statistics of one task, execution times are in Timer0 counts (FOSC/4) */
+typedef struct{
+    uint16 next_release;                /* tick of the next release */
+    uint16 runs;
+    uint16 overruns;                    /* releases skipped because the task started a full period late */
+    uint16 last_execution;
+    uint16 max_execution;               /* saturates at 0xFFFF */
+}scheduler_task_stats_t;
+
+/***********************************Function Declarations*******************************/
+
+/**
+ * @brief Install the task table and clear the tick counter and the task statistics
+ * @param _timer pointer to the Timer0 configurations driving the tick, read for the execution times
+ * @param _tasks pointer to the task table, must stay valid while the scheduler runs
+ * @param _task_count number of entries in the task table (SCHEDULER_MAX_TASKS at most)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType scheduler_init(const timer0_t *_timer , const scheduler_task_t *_tasks , uint8 _task_count);
+/**
+ * @brief Advance the system tick, called from the Timer0 interrupt handler
+ */
+void scheduler_tick(void);
+/**
+ * @brief Run every task whose release time has come, called from the main loop
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (scheduler not initialized)
+ */
+Std_ReturnType scheduler_dispatch(void);
+/**
+ * @brief Read the current system tick
+ * @param _ticks the number of ticks since scheduler_init() , wraps around
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType scheduler_get_ticks(uint16 *_ticks);
+/**
+ * @brief Read the run time statistics of one task
+ * @param _task_index index of the task in the task table
+ * @param _stats copy of the task statistics
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType scheduler_get_task_stats(uint8 _task_index , scheduler_task_stats_t *_stats);
+
+#endif	/* ECU_SCHEDULER_H */
+
@@ -0,0 +1,27 @@
+/* 
+ * File:   ecu_scheduler_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 12:20 PM
+ */
+
+#ifndef ECU_SCHEDULER_CFG_H
+#define	ECU_SCHEDULER_CFG_H
+
+/****************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* Period of the system tick driven by Timer0 (prescaler disabled, 16-bit mode) */
+#define SCHEDULER_TICK_PERIOD_US        1000UL
+/* Largest task table accepted by scheduler_init() */
+#define SCHEDULER_MAX_TASKS             8U
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* ECU_SCHEDULER_CFG_H */
+
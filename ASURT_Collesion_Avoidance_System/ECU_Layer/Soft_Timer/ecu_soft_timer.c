@@ -0,0 +1,235 @@
+/* 
+ * File:   ecu_soft_timer.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 01:10 PM
+ */
+
+#include "ecu_soft_timer.h"
+
+/* Running timers sorted by expiry, the head delta is the ticks left until the first expiry */
+static soft_timer_t *soft_timer_head = NULL;
+static uint16 soft_timer_last_tick = 0;
+
+static void soft_timer_insert(soft_timer_t *_timer);
+static void soft_timer_remove(soft_timer_t *_timer);
+
+/**
+ * @brief Empty the running list and take the tick the elapsed time is measured from
+ * @param _now the current tick
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_init(uint16 _now){
+    Std_ReturnType retVal = E_NOT_OK;
+    while(NULL != soft_timer_head){
+        soft_timer_head->active = 0;
+        soft_timer_head = soft_timer_head->next;
+    }
+    soft_timer_last_tick = _now;
+    retVal = E_OK;
+    return retVal;
+}
+
+/**
+ * @brief Set up a stopped virtual timer
+ * @param _timer pointer to the virtual timer
+ * @param _callback function called at every expiry
+ * @param _period expiry period in ticks
+ * @param _mode SOFT_TIMER_ONE_SHOT or SOFT_TIMER_PERIODIC
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_create(soft_timer_t *_timer , void (* _callback)(void) , uint16 _period , soft_timer_mode_t _mode){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _timer) || (NULL == _callback) || (0 == _period) || (1 == _timer->active)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        _timer->callback = _callback;
+        _timer->next = NULL;
+        _timer->period = _period;
+        _timer->delta = 0;
+        _timer->mode = _mode;
+        _timer->active = 0;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Start a stopped virtual timer, it expires one period from now
+ * @param _timer pointer to the virtual timer
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (already running)
+ */
+Std_ReturnType soft_timer_start(soft_timer_t *_timer){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _timer) || (NULL == _timer->callback) || (1 == _timer->active)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        soft_timer_insert(_timer);
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Stop a virtual timer, stopping a stopped timer is allowed
+ * @param _timer pointer to the virtual timer
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_stop(soft_timer_t *_timer){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _timer){
+        retVal = E_NOT_OK;
+    }
+    else{
+        if(1 == _timer->active){
+            soft_timer_remove(_timer);
+        }
+        else{ /* Nothing */ }
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Restart a virtual timer, running or not, so it expires one period from now
+ * @param _timer pointer to the virtual timer
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_restart(soft_timer_t *_timer){
+    Std_ReturnType retVal = E_NOT_OK;
+    retVal = soft_timer_stop(_timer);
+    if(E_OK == retVal){
+        retVal = soft_timer_start(_timer);
+    }
+    else{ /* Nothing */ }
+    return retVal;
+}
+
+/**
+ * @brief Change the period of a virtual timer in O(1), a running timer keeps its current expiry
+ *        and a periodic one is re-armed with the new period from that expiry on
+ * @param _timer pointer to the virtual timer
+ * @param _period new expiry period in ticks
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_set_period(soft_timer_t *_timer , uint16 _period){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _timer) || (0 == _period)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* Only read when the timer is (re)linked, the delta of the running timer is untouched */
+        _timer->period = _period;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Read whether a virtual timer is running
+ * @param _timer pointer to the virtual timer
+ * @param _active 1 when the timer is running, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_is_active(const soft_timer_t *_timer , uint8 *_active){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _timer) || (NULL == _active)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_active = _timer->active;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Account the ticks elapsed since the previous call and fire the expired timers,
+ *        called from the main loop
+ * @param _now the current tick
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_process(uint16 _now){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint16 l_elapsed = (uint16)(_now - soft_timer_last_tick);
+    soft_timer_t *l_expired = NULL;
+    soft_timer_last_tick = _now;
+    /* Only the head is touched per tick, every expired timer costs one pop */
+    while((NULL != soft_timer_head) && (l_elapsed >= soft_timer_head->delta)){
+        l_elapsed -= soft_timer_head->delta;
+        l_expired = soft_timer_head;
+        soft_timer_head = l_expired->next;
+        l_expired->next = NULL;
+        l_expired->active = 0;
+        /* Re-armed from its expiry, not from now, so a late call does not stretch the period */
+        if(SOFT_TIMER_PERIODIC == l_expired->mode){
+            soft_timer_insert(l_expired);
+        }
+        else{ /* Nothing */ }
+        /* Called last so the callback may stop or restart any timer , itself included ,
+           a timer started here counts from this expiry */
+        l_expired->callback();
+    }
+    if(NULL != soft_timer_head){
+        soft_timer_head->delta -= l_elapsed;
+    }
+    else{ /* Nothing */ }
+    retVal = E_OK;
+    return retVal;
+}
+
+/*--------------------------------------Helper functions---------------------------------------*/
+
+/* Link a stopped timer at its place in the delta list, one period after the list origin */
+static void soft_timer_insert(soft_timer_t *_timer){
+    soft_timer_t **l_link = &soft_timer_head;
+    uint16 l_delta = _timer->period;
+    while((NULL != *l_link) && ((*l_link)->delta <= l_delta)){
+        l_delta -= (*l_link)->delta;
+        l_link = &((*l_link)->next);
+    }
+    _timer->delta = l_delta;
+    _timer->next = *l_link;
+    if(NULL != _timer->next){
+        _timer->next->delta -= l_delta;
+    }
+    else{ /* Nothing */ }
+    *l_link = _timer;
+    _timer->active = 1;
+}
+
+/* Unlink a running timer, its remaining ticks are handed to the timer after it */
+static void soft_timer_remove(soft_timer_t *_timer){
+    soft_timer_t **l_link = &soft_timer_head;
+    while((NULL != *l_link) && (_timer != *l_link)){
+        l_link = &((*l_link)->next);
+    }
+    if(NULL != *l_link){
+        *l_link = _timer->next;
+        if(NULL != _timer->next){
+            _timer->next->delta += _timer->delta;
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
+    _timer->next = NULL;
+    _timer->active = 0;
+}
@@ -0,0 +1,116 @@
+/* 
+ * File:   ecu_soft_timer.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 01:10 PM
+ */
+
+#ifndef ECU_SOFT_TIMER_H
+#define	ECU_SOFT_TIMER_H
+
+/****************************************Includes***************************************/
+
+#include "../../MCAL_Layer/mcal_std_types.h"
+
+/***********************************Macro Declarations**********************************/
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+typedef enum{
+    SOFT_TIMER_ONE_SHOT = 0,
+    SOFT_TIMER_PERIODIC
+}soft_timer_mode_t;
+
+/*
+ * Virtual timer, allocated by its user. Running timers are kept in a delta list sorted by
+ * expiry : each one stores the ticks remaining after the timer before it, so a tick only
+ * touches the head of the list.
+ */
+typedef struct soft_timer{
+    void (* callback)(void);            /* called from soft_timer_process() , main loop context */
+    struct soft_timer *next;
+    uint16 period;                      /* ticks, must not be 0 */
+    uint16 delta;                       /* ticks after the previous timer of the list */
+    uint8 mode      : 1;                /* soft_timer_mode_t */
+    uint8 active    : 1;                /* linked in the running list */
+    uint8 reserved  : 6;
+}soft_timer_t;
+
+/***********************************Function Declarations*******************************/
+
+/**
+ * @brief Empty the running list and take the tick the elapsed time is measured from
+ * @param _now the current tick
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_init(uint16 _now);
+/**
+ * @brief Set up a stopped virtual timer
+ * @param _timer pointer to the virtual timer
+ * @param _callback function called at every expiry
+ * @param _period expiry period in ticks
+ * @param _mode SOFT_TIMER_ONE_SHOT or SOFT_TIMER_PERIODIC
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_create(soft_timer_t *_timer , void (* _callback)(void) , uint16 _period , soft_timer_mode_t _mode);
+/**
+ * @brief Start a stopped virtual timer, it expires one period from now
+ * @param _timer pointer to the virtual timer
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (already running)
+ */
+Std_ReturnType soft_timer_start(soft_timer_t *_timer);
+/**
+ * @brief Stop a virtual timer, stopping a stopped timer is allowed
+ * @param _timer pointer to the virtual timer
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_stop(soft_timer_t *_timer);
+/**
+ * @brief Restart a virtual timer, running or not, so it expires one period from now
+ * @param _timer pointer to the virtual timer
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_restart(soft_timer_t *_timer);
+/**
+ * @brief Change the period of a virtual timer in O(1), a running timer keeps its current expiry
+ *        and a periodic one is re-armed with the new period from that expiry on
+ * @param _timer pointer to the virtual timer
+ * @param _period new expiry period in ticks
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_set_period(soft_timer_t *_timer , uint16 _period);
+/**
+ * @brief Read whether a virtual timer is running
+ * @param _timer pointer to the virtual timer
+ * @param _active 1 when the timer is running, 0 otherwise
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_is_active(const soft_timer_t *_timer , uint8 *_active);
+/**
+ * @brief Account the ticks elapsed since the previous call and fire the expired timers,
+ *        called from the main loop
+ * @param _now the current tick
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType soft_timer_process(uint16 _now);
+
+#endif	/* ECU_SOFT_TIMER_H */
+
@@ -0,0 +1,136 @@
+/* 
+ * File:   ecu_ttc_estimator.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 04:20 PM
+ */
+
+#include "ecu_ttc_estimator.h"
+
+/* Rate clamp (Q8 , 2000 cm/s) keeping the prediction product within 32 bits */
+#define TTC_ESTIMATOR_MAX_RATE_Q8       (2000L * 256L)
+
+static uint16 ttc_estimator_predict(const ttc_estimator_t *_estimator);
+
+/**
+ * @brief Forget the tracked obstacle , the next sample starts a new track
+ * @param _estimator pointer to the estimator
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ttc_estimator_reset(ttc_estimator_t *_estimator){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _estimator){
+        retVal = E_NOT_OK;
+    }
+    else{
+        _estimator->distance_q8 = 0;
+        _estimator->rate_q8 = 0;
+        _estimator->last_timestamp_us = 0;
+        _estimator->valid = 0;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Filter one timestamped distance sample and predict the time-to-collision
+ * @param _estimator pointer to the estimator
+ * @param _distance the measured distance (cm)
+ * @param _timestamp_us arrival time of the sample (time_now_us() , wraps around)
+ * @param _ttc_ms predicted time-to-collision (ms) , TTC_ESTIMATOR_NONE while not closing
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ttc_estimator_update(ttc_estimator_t *_estimator , uint16 _distance , uint32 _timestamp_us , uint16 *_ttc_ms){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint32 l_interval_ms = 0;
+    sint32 l_residual = 0;
+    if((NULL == _estimator) || (NULL == _ttc_ms)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_interval_ms = (uint32)(_timestamp_us - _estimator->last_timestamp_us) / 1000UL;
+        if(TTC_ESTIMATOR_MAX_DISTANCE < _distance){
+            /* Out of the tracked range : nothing to collide with */
+            (void)ttc_estimator_reset(_estimator);
+        }
+        else if((0 == _estimator->valid) || (TTC_ESTIMATOR_MAX_INTERVAL_MS < l_interval_ms)){
+            _estimator->distance_q8 = (sint32)_distance * 256L;
+            _estimator->rate_q8 = 0;
+            _estimator->last_timestamp_us = _timestamp_us;
+            _estimator->valid = 1;
+        }
+        else{
+            if(TTC_ESTIMATOR_MIN_INTERVAL_MS <= l_interval_ms){
+                /* Predict : |rate| <= 2000 cm/s , interval <= 1000 ms */
+                _estimator->distance_q8 += (_estimator->rate_q8 * (sint32)l_interval_ms) / 1000L;
+                _estimator->last_timestamp_us = _timestamp_us;
+            }
+            else{ /* Nothing */ }
+            /* Correct : the residual is within +-2^20 (Q8 of the tracked range) */
+            l_residual = ((sint32)_distance * 256L) - _estimator->distance_q8;
+            _estimator->distance_q8 += (l_residual * TTC_ESTIMATOR_ALPHA_Q8) / 256L;
+            if(TTC_ESTIMATOR_MIN_INTERVAL_MS <= l_interval_ms){
+                _estimator->rate_q8 += (((l_residual * TTC_ESTIMATOR_BETA_Q8) / 256L) * 1000L) / (sint32)l_interval_ms;
+                if(TTC_ESTIMATOR_MAX_RATE_Q8 < _estimator->rate_q8){
+                    _estimator->rate_q8 = TTC_ESTIMATOR_MAX_RATE_Q8;
+                }
+                else if(-TTC_ESTIMATOR_MAX_RATE_Q8 > _estimator->rate_q8){
+                    _estimator->rate_q8 = -TTC_ESTIMATOR_MAX_RATE_Q8;
+                }
+                else{ /* Nothing */ }
+            }
+            else{ /* Nothing */ }
+            /* A receding prediction may overshoot the tracked range , keep the bound ttc_estimator_predict relies on */
+            if(0 > _estimator->distance_q8){
+                _estimator->distance_q8 = 0;
+            }
+            else if(((sint32)TTC_ESTIMATOR_MAX_DISTANCE * 256L) < _estimator->distance_q8){
+                _estimator->distance_q8 = (sint32)TTC_ESTIMATOR_MAX_DISTANCE * 256L;
+            }
+            else{ /* Nothing */ }
+        }
+        *_ttc_ms = ttc_estimator_predict(_estimator);
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Read the filtered closing speed
+ * @param _estimator pointer to the estimator
+ * @param _closing_speed closing speed (cm/s) , negative while the obstacle moves away
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ttc_estimator_get_closing_speed(const ttc_estimator_t *_estimator , sint16 *_closing_speed){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _estimator) || (NULL == _closing_speed)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_closing_speed = (sint16)(-(_estimator->rate_q8 / 256L));
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/*--------------------------------------Helper functions---------------------------------------*/
+
+/* Distance over closing speed , both Q8 : distance_q8 <= TTC_ESTIMATOR_MAX_DISTANCE * 256 (clamped by
+   ttc_estimator_update , checked against 32 bits in the header) so the x1000 fits 32 bits */
+static uint16 ttc_estimator_predict(const ttc_estimator_t *_estimator){
+    uint16 l_ttc_ms = TTC_ESTIMATOR_NONE;
+    sint32 l_closing_q8 = -(_estimator->rate_q8);
+    uint32 l_ttc = 0;
+    if((1 == _estimator->valid) && ((TTC_ESTIMATOR_MIN_CLOSING_SPEED * 256L) <= l_closing_q8)){
+        l_ttc = ((uint32)_estimator->distance_q8 * 1000UL) / (uint32)l_closing_q8;
+        l_ttc_ms = (TTC_ESTIMATOR_NONE <= l_ttc) ? (uint16)(TTC_ESTIMATOR_NONE - 1U) : (uint16)l_ttc;
+    }
+    else{ /* Nothing */ }
+    return l_ttc_ms;
+}
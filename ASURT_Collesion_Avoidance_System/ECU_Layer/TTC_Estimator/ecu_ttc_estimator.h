@@ -0,0 +1,78 @@
+/* 
+ * File:   ecu_ttc_estimator.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 04:20 PM
+ */
+
+#ifndef ECU_TTC_ESTIMATOR_H
+#define	ECU_TTC_ESTIMATOR_H
+
+/****************************************Includes***************************************/
+
+#include "../../MCAL_Layer/mcal_std_types.h"
+#include "ecu_ttc_estimator_cfg.h"
+
+/***********************************Macro Declarations**********************************/
+
+/* Time-to-collision reported while the obstacle is not closing (ms) */
+#define TTC_ESTIMATOR_NONE                  0xFFFFU
+
+#if (TTC_ESTIMATOR_ALPHA_Q8 <= 0L) || (TTC_ESTIMATOR_ALPHA_Q8 > 256L) || (TTC_ESTIMATOR_BETA_Q8 <= 0L) || (TTC_ESTIMATOR_BETA_Q8 > 256L)
+#error "The alpha-beta gains must be in ]0 , 1] (Q8)"
+#endif
+/* TTC_ESTIMATOR_MAX_DISTANCE * 256 * 1000 must fit 32 bits , checked by division to stay within 32-bit
+   preprocessor arithmetic */
+#if TTC_ESTIMATOR_MAX_DISTANCE > (0xFFFFFFFFUL / (256UL * 1000UL))
+#error "TTC_ESTIMATOR_MAX_DISTANCE overflows the 32-bit time-to-collision division"
+#endif
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/*
+ * Alpha-beta tracker of one obstacle, fixed point Q8 : distance in 1/256 cm and rate in 1/256 cm/s
+ * (negative while the obstacle is closing in)
+ */
+typedef struct{
+    sint32 distance_q8;
+    sint32 rate_q8;
+    uint32 last_timestamp_us;
+    uint8 valid     : 1;                /* a first sample initialized the tracker */
+    uint8 reserved  : 7;
+}ttc_estimator_t;
+
+/***********************************Function Declarations*******************************/
+
+/**
+ * @brief Forget the tracked obstacle , the next sample starts a new track
+ * @param _estimator pointer to the estimator
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ttc_estimator_reset(ttc_estimator_t *_estimator);
+/**
+ * @brief Filter one timestamped distance sample and predict the time-to-collision
+ * @param _estimator pointer to the estimator
+ * @param _distance the measured distance (cm)
+ * @param _timestamp_us arrival time of the sample (time_now_us() , wraps around)
+ * @param _ttc_ms predicted time-to-collision (ms) , TTC_ESTIMATOR_NONE while not closing
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ttc_estimator_update(ttc_estimator_t *_estimator , uint16 _distance , uint32 _timestamp_us , uint16 *_ttc_ms);
+/**
+ * @brief Read the filtered closing speed
+ * @param _estimator pointer to the estimator
+ * @param _closing_speed closing speed (cm/s) , negative while the obstacle moves away
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ttc_estimator_get_closing_speed(const ttc_estimator_t *_estimator , sint16 *_closing_speed);
+
+#endif	/* ECU_TTC_ESTIMATOR_H */
+
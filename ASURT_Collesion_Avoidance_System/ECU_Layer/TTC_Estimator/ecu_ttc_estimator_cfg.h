@@ -0,0 +1,34 @@
+/* 
+ * File:   ecu_ttc_estimator_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 04:20 PM
+ */
+
+#ifndef ECU_TTC_ESTIMATOR_CFG_H
+#define	ECU_TTC_ESTIMATOR_CFG_H
+
+/****************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* Alpha-beta gains in Q8 (256 = 1.0) : alpha 0.5 on the distance , beta 0.15 on the closing speed */
+#define TTC_ESTIMATOR_ALPHA_Q8              128L
+#define TTC_ESTIMATOR_BETA_Q8               38L
+/* Samples closer than this (ms) only correct the distance , their speed estimate is too noisy */
+#define TTC_ESTIMATOR_MIN_INTERVAL_MS       10UL
+/* A longer gap between samples (ms) restarts the filter from the new sample */
+#define TTC_ESTIMATOR_MAX_INTERVAL_MS       1000UL
+/* Longest distance tracked (cm) , a farther sample restarts the filter */
+#define TTC_ESTIMATOR_MAX_DISTANCE          1000U
+/* Closing speed (cm/s) below which no time-to-collision is predicted */
+#define TTC_ESTIMATOR_MIN_CLOSING_SPEED     5L
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* ECU_TTC_ESTIMATOR_CFG_H */
+
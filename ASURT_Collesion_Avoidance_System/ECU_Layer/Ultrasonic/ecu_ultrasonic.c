@@ -0,0 +1,143 @@
+/* 
+ * File:   ecu_ultrasonic.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 06:10 PM
+ */
+
+#include "ecu_ultrasonic.h"
+
+/* Ranger served by the CCP and Timer3 interrupt handlers */
+static ultrasonic_t *ultrasonic_active = NULL;
+
+static void ultrasonic_timer_start(const ultrasonic_t *_sensor , uint16 _period_us);
+static void ultrasonic_complete(ultrasonic_t *_sensor , uint16 _distance_cm);
+
+/**
+ * @brief Initialize the trigger pin , stop the capture and Timer3 , the ranger becomes the one served by the ISRs
+ * @param _sensor pointer to the ranger
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ultrasonic_init(ultrasonic_t *_sensor){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _sensor) || (NULL == _sensor->echo_ccp) || (NULL == _sensor->timer)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        TIMER3_MODULE_DISABLE();
+        retVal = CCP_Capture_Mode_Select(_sensor->echo_ccp , CCP_MODULE_DISABLE);
+        _sensor->state = ULTRASONIC_IDLE;
+        _sensor->rise_capture = 0;
+        _sensor->last_echo_us = 0;
+        _sensor->readings = 0;
+        _sensor->timeouts = 0;
+        _sensor->trigger_pin.direction = GPIO_DIRECTION_OUTPUT;
+        _sensor->trigger_pin.logic = GPIO_LOW;
+        if(E_OK == retVal){
+            retVal = gpio_pin_initialize(&(_sensor->trigger_pin));
+        }
+        else{ /* Nothing */ }
+        ultrasonic_active = _sensor;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Start one measurement , the reading is delivered to the callback
+ * @param _sensor pointer to the ranger
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (a measurement is still running)
+ */
+Std_ReturnType ultrasonic_trigger(ultrasonic_t *_sensor){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _sensor){
+        retVal = E_NOT_OK;
+    }
+    else if(ULTRASONIC_IDLE != _sensor->state){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* Idle : no capture and no Timer3 interrupt can be pending , the ISRs do not touch the state */
+        _sensor->state = ULTRASONIC_TRIGGER;
+        retVal = gpio_pin_write_logic(&(_sensor->trigger_pin) , GPIO_HIGH);
+        ultrasonic_timer_start(_sensor , ULTRASONIC_TRIGGER_PULSE_US);
+    }
+    return retVal;
+}
+
+/**
+ * @brief Echo edge captured , called from the CCP interrupt handler
+ */
+void ultrasonic_capture_isr(void){
+    ultrasonic_t *l_sensor = ultrasonic_active;
+    uint16 l_capture = 0;
+    uint16 l_echo_us = 0;
+    if(NULL != l_sensor){
+        (void)CCP_Capture_Mode_Read_Value(l_sensor->echo_ccp , &l_capture);
+        if(ULTRASONIC_WAIT_RISE == l_sensor->state){
+            l_sensor->rise_capture = l_capture;
+            (void)CCP_Capture_Mode_Select(l_sensor->echo_ccp , CCP_CAPTURE_MODE_1_FALLING_EDGE);
+            l_sensor->state = ULTRASONIC_WAIT_FALL;
+        }
+        else if(ULTRASONIC_WAIT_FALL == l_sensor->state){
+            TIMER3_MODULE_DISABLE();
+            (void)CCP_Capture_Mode_Select(l_sensor->echo_ccp , CCP_MODULE_DISABLE);
+            /* Both edges are Timer1 microseconds , the 16-bit difference holds up to 65 ms */
+            l_echo_us = (uint16)(l_capture - l_sensor->rise_capture);
+            l_sensor->last_echo_us = l_echo_us;
+            l_sensor->readings++;
+            ultrasonic_complete(l_sensor , (uint16)((((uint32)l_echo_us * 10UL) + (ULTRASONIC_US_PER_CM_X10 / 2UL)) / ULTRASONIC_US_PER_CM_X10));
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
+}
+
+/**
+ * @brief Trigger pulse or echo timeout elapsed , called from the Timer3 interrupt handler
+ */
+void ultrasonic_timer_isr(void){
+    ultrasonic_t *l_sensor = ultrasonic_active;
+    if(NULL != l_sensor){
+        TIMER3_MODULE_DISABLE();
+        switch(l_sensor->state){
+            case ULTRASONIC_TRIGGER :
+                (void)gpio_pin_write_logic(&(l_sensor->trigger_pin) , GPIO_LOW);
+                (void)CCP_Capture_Mode_Select(l_sensor->echo_ccp , CCP_CAPTURE_MODE_1_RISING_EDGE);
+                l_sensor->state = ULTRASONIC_WAIT_RISE;
+                ultrasonic_timer_start(l_sensor , ULTRASONIC_ECHO_TIMEOUT_US);
+                break;
+            case ULTRASONIC_WAIT_RISE :
+            case ULTRASONIC_WAIT_FALL :
+                (void)CCP_Capture_Mode_Select(l_sensor->echo_ccp , CCP_MODULE_DISABLE);
+                l_sensor->timeouts++;
+                ultrasonic_complete(l_sensor , ULTRASONIC_NO_ECHO);
+                break;
+            default :
+                break;
+        }
+    }
+    else{ /* Nothing */ }
+}
+
+/*--------------------------------- Helper Functions --------------------------------------*/
+
+/* One-shot : Timer3 overflows _period_us microseconds from now */
+static void ultrasonic_timer_start(const ultrasonic_t *_sensor , uint16 _period_us){
+    TIMER3_MODULE_DISABLE();
+    (void)timer3_write_value(_sensor->timer , (uint16)(0x10000UL - _period_us));
+    TIMER3_InterruptFlagClear();
+    TIMER3_MODULE_ENABLE();
+}
+
+/* Idle before the callback so it may start the next measurement */
+static void ultrasonic_complete(ultrasonic_t *_sensor , uint16 _distance_cm){
+    _sensor->state = ULTRASONIC_IDLE;
+    if(NULL != _sensor->reading_callback){
+        _sensor->reading_callback(_distance_cm);
+    }
+    else{ /* Nothing */ }
+}
@@ -0,0 +1,81 @@
+/* 
+ * File:   ecu_ultrasonic.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 06:10 PM
+ */
+
+#ifndef ECU_ULTRASONIC_H
+#define	ECU_ULTRASONIC_H
+
+/****************************************Includes***************************************/
+
+#include "../../MCAL_Layer/CCP/hal_ccp.h"
+#include "../../MCAL_Layer/Timer3/hal_timer3.h"
+#include "ecu_ultrasonic_cfg.h"
+
+/***********************************Macro Declarations**********************************/
+
+/* Distance reported when no echo ended before ULTRASONIC_ECHO_TIMEOUT_US */
+#define ULTRASONIC_NO_ECHO              0xFFFFU
+
+#if (ULTRASONIC_TRIGGER_PULSE_US < 10U) || (ULTRASONIC_ECHO_TIMEOUT_US <= ULTRASONIC_TRIGGER_PULSE_US)
+#error "ULTRASONIC_TRIGGER_PULSE_US must be 10 us at least and shorter than ULTRASONIC_ECHO_TIMEOUT_US"
+#endif
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+typedef enum{
+    ULTRASONIC_IDLE = 0,
+    ULTRASONIC_TRIGGER,                 /* trigger pin high , Timer3 times the pulse */
+    ULTRASONIC_WAIT_RISE,               /* capturing the echo rising edge */
+    ULTRASONIC_WAIT_FALL                /* capturing the echo falling edge */
+}ultrasonic_state_t;
+
+/*
+ * One ultrasonic ranger : both echo edges are captured by the CCP module clocked by the Timer1
+ * microsecond timebase (capture timer CCP1_CCP2_TIMER1) , Timer3 counting 1 us per count times the
+ * trigger pulse and the echo timeout. The whole measurement runs from the CCP and Timer3 interrupts.
+ */
+typedef struct{
+    pin_config_t trigger_pin;
+    const ccp_t *echo_ccp;              /* capture module on the echo pin */
+    const timer3_t *timer;              /* Timer3 , 1 us per count */
+    void (* reading_callback)(uint16 distance_cm);  /* called from the interrupt , ULTRASONIC_NO_ECHO on timeout */
+    volatile ultrasonic_state_t state;
+    uint16 rise_capture;                /* Timer1 count at the echo rising edge */
+    uint16 last_echo_us;                /* echo pulse width of the last reading */
+    uint16 readings;
+    uint16 timeouts;
+}ultrasonic_t;
+
+/***********************************Function Declarations*******************************/
+
+/**
+ * @brief Initialize the trigger pin , stop the capture and Timer3 , the ranger becomes the one served by the ISRs
+ * @param _sensor pointer to the ranger
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ultrasonic_init(ultrasonic_t *_sensor);
+/**
+ * @brief Start one measurement , the reading is delivered to the callback
+ * @param _sensor pointer to the ranger
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (a measurement is still running)
+ */
+Std_ReturnType ultrasonic_trigger(ultrasonic_t *_sensor);
+/**
+ * @brief Echo edge captured , called from the CCP interrupt handler
+ */
+void ultrasonic_capture_isr(void);
+/**
+ * @brief Trigger pulse or echo timeout elapsed , called from the Timer3 interrupt handler
+ */
+void ultrasonic_timer_isr(void);
+
+#endif	/* ECU_ULTRASONIC_H */
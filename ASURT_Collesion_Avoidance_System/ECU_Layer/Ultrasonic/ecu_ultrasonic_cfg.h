@@ -0,0 +1,28 @@
+/* 
+ * File:   ecu_ultrasonic_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 06:10 PM
+ */
+
+#ifndef ECU_ULTRASONIC_CFG_H
+#define	ECU_ULTRASONIC_CFG_H
+
+/****************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* Trigger pulse width (us) , the HC-SR04 needs 10 us at least */
+#define ULTRASONIC_TRIGGER_PULSE_US     12U
+/* Echo wait from the end of the trigger (us) : about 4.3 m , past the 4 m range of the sensor */
+#define ULTRASONIC_ECHO_TIMEOUT_US      25000U
+/* Round trip time per cm x10 : 58.3 us at 343 m/s */
+#define ULTRASONIC_US_PER_CM_X10        583UL
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* ECU_ULTRASONIC_CFG_H */
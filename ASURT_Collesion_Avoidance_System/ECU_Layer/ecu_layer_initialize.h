@@ -11,6 +11,15 @@
 /***************************************Includes***************************************/
 
 #include "LED/ecu_led.h"
+#include "Link_Frame/ecu_link_frame.h"
+#include "Link_Speed/ecu_link_speed.h"
+#include "Event_Queue/ecu_event_queue.h"
+#include "Scheduler/ecu_scheduler.h"
+#include "Soft_Timer/ecu_soft_timer.h"
+#include "Alert_Zone/ecu_alert_zone.h"
+#include "TTC_Estimator/ecu_ttc_estimator.h"
+#include "Link_Supervisor/ecu_link_supervisor.h"
+#include "Ultrasonic/ecu_ultrasonic.h"
 
 /***********************************Macro Declarations**********************************/
 
@@ -10,9 +10,30 @@
 
 #if ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
 static void(*ADC_InterruptHandler)(void) = NULL;  
+#ifdef ADC_INTERRUPT_HANDLER
+void ADC_INTERRUPT_HANDLER(void);
+#endif
+#endif
+
+#if ADC_SCAN_CONFIGURATION==CONFIG_ENABLE
+/* Running scan , set by ADC_Scan_Start and stepped by the ADC interrupt */
+static const adc_config_t *adc_scan_config = NULL;
+static const adc_scan_t *adc_scan_list = NULL;
+static volatile uint8 adc_scan_active = 0;
+static uint8 adc_scan_index = 0;
+/* Double buffer : the interrupt fills one half while the other one holds the published scan */
+static uint16 adc_scan_results[2][ADC_SCAN_MAX_CHANNELS];
+static uint8 adc_scan_fill = 0;
+static volatile uint8 adc_scan_published = 0;
+static volatile uint8 adc_scan_published_count = 0;
+static volatile uint8 adc_scan_sequence = 0;
 #endif
 
 static inline void adc_input_channel_port_config(adc_channel_select_t channel);
+static inline void adc_conversion_handler_call(void);
+#if ADC_SCAN_CONFIGURATION==CONFIG_ENABLE
+static void adc_scan_step(void);
+#endif
 
 
 /**
@@ -240,6 +261,104 @@ Std_ReturnType ADC_Start_Conversion_Interrupt(const adc_config_t *adc , adc_chan
     return retVal;
 }
 
+#if ADC_SCAN_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Start converting a channel list from the ADC interrupt , the single conversion functions
+ *        must not be used until the scan ends
+ * @param adc pointer to the ADC configurations
+ * @param scan pointer to the channel list , must stay valid while the scan runs
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (conversion or scan already running)
+ */
+Std_ReturnType ADC_Scan_Start(const adc_config_t *adc , const adc_scan_t *scan){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_index = 0;
+    if((NULL == adc) || (NULL == scan) || (NULL == scan->channels) ||
+       (0U == scan->channel_count) || (ADC_SCAN_MAX_CHANNELS < scan->channel_count)){
+        retVal = E_NOT_OK;
+    }
+    else if((1 == adc_scan_active) || (0 != ADC_CONVERSION_STATUS())){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* The pins are configured once , the interrupt only switches CHS */
+        for(l_index = 0 ; l_index < scan->channel_count ; l_index++){
+            adc_input_channel_port_config(scan->channels[l_index]);
+        }
+        adc_scan_config = adc;
+        adc_scan_list = scan;
+        adc_scan_index = 0;
+        adc_scan_active = 1;
+        ADCON0bits.CHS = scan->channels[0];
+        ADC_START_CONVERSION();
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Stop the scan at the end of the running conversion , its partial results are dropped
+ * @param adc pointer to the ADC configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ADC_Scan_Stop(const adc_config_t *adc){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == adc){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* Masked so the interrupt never sees a stopped scan with its conversion still pending */
+        ADC_InterruptDisable();
+        adc_scan_active = 0;
+        /* Clearing GO/DONE aborts the running conversion */
+        ADCON0bits.GODONE = 0;
+        ADC_InterruptFlagClear();
+        ADC_InterruptEnable();
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Copy the latest published scan , one result per channel in the scan order
+ * @param adc pointer to the ADC configurations
+ * @param results array of channel_count results at least
+ * @param sequence number of the copied scan , counts the published scans and wraps around
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (no scan published yet)
+ */
+Std_ReturnType ADC_Scan_Read(const adc_config_t *adc , uint16 *results , uint8 *sequence){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_sequence = 0;
+    uint8 l_buffer = 0;
+    uint8 l_count = 0;
+    uint8 l_index = 0;
+    if((NULL == adc) || (NULL == results) || (NULL == sequence)){
+        retVal = E_NOT_OK;
+    }
+    else if(0 == adc_scan_published_count){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* Copied again when a scan was published meanwhile , the interrupt may be refilling the copied half */
+        do{
+            l_sequence = adc_scan_sequence;
+            l_buffer = adc_scan_published;
+            l_count = adc_scan_published_count;
+            for(l_index = 0 ; l_index < l_count ; l_index++){
+                results[l_index] = adc_scan_results[l_buffer][l_index];
+            }
+        }while(l_sequence != adc_scan_sequence);
+        *sequence = l_sequence;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+#endif
 
 /*-------------------------------------- Helper Functions ------------------------------------------*/
 
@@ -263,9 +382,60 @@ static inline void adc_input_channel_port_config(adc_channel_select_t channel){
 }
 
 
-void ADC_ISR(void){
-    ADC_InterruptFlagClear();
+static inline void adc_conversion_handler_call(void){
+#ifdef ADC_INTERRUPT_HANDLER
+    ADC_INTERRUPT_HANDLER();
+#else
     if(ADC_InterruptHandler){
         ADC_InterruptHandler();
     }
+#endif
+}
+
+#if ADC_SCAN_CONFIGURATION==CONFIG_ENABLE
+/* Stores the result and starts the next channel at once , the interrupt latency covers the 2 TAD wait between conversions */
+static void adc_scan_step(void){
+    uint16 l_result = 0;
+    (void)ADC_Get_Conversion_Result(adc_scan_config , &l_result);
+    adc_scan_results[adc_scan_fill][adc_scan_index] = l_result;
+    adc_scan_index++;
+    if(adc_scan_index < adc_scan_list->channel_count){
+        ADCON0bits.CHS = adc_scan_list->channels[adc_scan_index];
+        ADC_START_CONVERSION();
+    }
+    else{
+        /* Published before the sequence moves so a reader that saw the new sequence copies the new half */
+        adc_scan_published = adc_scan_fill;
+        adc_scan_published_count = adc_scan_list->channel_count;
+        adc_scan_sequence++;
+        adc_scan_fill ^= 1U;
+        adc_scan_index = 0;
+        if(ADC_SCAN_CONTINUOUS == adc_scan_list->scan_mode){
+            ADCON0bits.CHS = adc_scan_list->channels[0];
+            ADC_START_CONVERSION();
+        }
+        else{
+            adc_scan_active = 0;
+        }
+        if(NULL != adc_scan_list->ADC_ScanCompleteHandler){
+            adc_scan_list->ADC_ScanCompleteHandler();
+        }
+        else{ /* Nothing */ }
+    }
+}
+#endif
+
+void ADC_ISR(void){
+    ADC_InterruptFlagClear();
+#if ADC_SCAN_CONFIGURATION==CONFIG_ENABLE
+    /* A running scan owns the conversions , the single conversion handler is not called */
+    if(1 == adc_scan_active){
+        adc_scan_step();
+    }
+    else{
+        adc_conversion_handler_call();
+    }
+#else
+    adc_conversion_handler_call();
+#endif
 }
\ No newline at end of file
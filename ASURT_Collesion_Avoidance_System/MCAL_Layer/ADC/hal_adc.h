@@ -48,6 +48,18 @@
 #define ADC_CONVERSION_COMPLETED        0x01U
 #define ADC_CONVERSION_IN_PROGRESS      0x00U
 
+#if ADC_SCAN_CONFIGURATION==CONFIG_ENABLE
+#if (0U == ADC_SCAN_MAX_CHANNELS) || (13U < ADC_SCAN_MAX_CHANNELS)
+#error "ADC_SCAN_MAX_CHANNELS must be between 1 and 13"
+#endif
+#if ADC_INTERRUPT_FEATURE_ENABLE!=INTERRUPT_FEATURE_ENABLE
+#error "The ADC scan runs from the ADC interrupt , ADC_INTERRUPT_FEATURE_ENABLE is required"
+#endif
+
+#define ADC_SCAN_SINGLE                 0x00U
+#define ADC_SCAN_CONTINUOUS             0x01U
+#endif
+
 /******************************Macro Function Declarations******************************/
 
 /* ADC Converstion Status : A/D in Progress / A/D Idle State */
@@ -140,6 +152,20 @@ typedef struct{
     uint8 : 6;
 }adc_config_t;
 
+#if ADC_SCAN_CONFIGURATION==CONFIG_ENABLE
+/*
+ * Channel list of a scan : the ADC interrupt reads each result and starts the next channel at once,
+ * the acquisition time of adc_config_t is inserted by the module before every conversion.
+ */
+typedef struct{
+    const adc_channel_select_t *channels;       /* scan order , must stay valid while the scan runs */
+    uint8 channel_count;                        /* 1 .. ADC_SCAN_MAX_CHANNELS */
+    uint8 scan_mode : 1;                        /* ADC_SCAN_SINGLE : one scan per start , ADC_SCAN_CONTINUOUS : restarted when published */
+    uint8 : 7;
+    void (* ADC_ScanCompleteHandler) (void);    /* called from the ADC interrupt once a scan is published */
+}adc_scan_t;
+#endif
+
 /***********************************Function Declarations*******************************/
 
 /**
@@ -213,6 +239,36 @@ Std_ReturnType ADC_Get_Conversion_Blocking(const adc_config_t *adc , adc_channel
  *          (E_NOT_OK) : the function has issue to perform this action
  */
 Std_ReturnType ADC_Start_Conversion_Interrupt(const adc_config_t *adc , adc_channel_select_t channel);
+#if ADC_SCAN_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Start converting a channel list from the ADC interrupt , the single conversion functions
+ *        must not be used until the scan ends
+ * @param adc pointer to the ADC configurations
+ * @param scan pointer to the channel list , must stay valid while the scan runs
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (conversion or scan already running)
+ */
+Std_ReturnType ADC_Scan_Start(const adc_config_t *adc , const adc_scan_t *scan);
+/**
+ * @brief Stop the scan at the end of the running conversion , its partial results are dropped
+ * @param adc pointer to the ADC configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType ADC_Scan_Stop(const adc_config_t *adc);
+/**
+ * @brief Copy the latest published scan , one result per channel in the scan order
+ * @param adc pointer to the ADC configurations
+ * @param results array of channel_count results at least
+ * @param sequence number of the copied scan , counts the published scans and wraps around
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (no scan published yet)
+ */
+Std_ReturnType ADC_Scan_Read(const adc_config_t *adc , uint16 *results , uint8 *sequence);
+#endif
 
 #endif	/* HAL_ADC_H */
 
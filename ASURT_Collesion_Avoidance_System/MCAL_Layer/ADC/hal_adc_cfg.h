@@ -12,6 +12,14 @@
 
 /***********************************Macro Declarations**********************************/
 
+/* 
+ * Auto-scan sequencer : a list of channels converted back-to-back from the ADC interrupt,
+ * each completed scan is published into one half of a double-buffered result array.
+ */
+#define ADC_SCAN_CONFIGURATION              CONFIG_ENABLE
+/* Longest channel list of a scan */
+#define ADC_SCAN_MAX_CHANNELS               8U
+
 /******************************Macro Function Declarations******************************/
 
 /***********************************Datatype Declarations*******************************/
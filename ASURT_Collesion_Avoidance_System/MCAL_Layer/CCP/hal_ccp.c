@@ -9,10 +9,16 @@
 
 #if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
     static void (*CCP1_InterruptHandler)(void) = NULL;
+    #ifdef CCP1_INTERRUPT_HANDLER
+    void CCP1_INTERRUPT_HANDLER(void);
+    #endif
 #endif
     
 #if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
     static void (*CCP2_InterruptHandler)(void) = NULL;
+    #ifdef CCP2_INTERRUPT_HANDLER
+    void CCP2_INTERRUPT_HANDLER(void);
+    #endif
 #endif
   
 static void CCP_Interrupt_Config(const ccp_t *_ccp_obj);
@@ -143,24 +149,81 @@ Std_ReturnType CCP_Is_Captured_Data_Ready(const ccp_t *_ccp_obj, uint8 *_capture
 
 /**
  * @brief Read a value in capture mode
+ * @param _ccp_obj pointer to the CCP module configurations
  * @param capture_value pointer to the data to be read
  * @return status of the function
  *          (E_OK) : the function done successfully
  *          (E_NOT_OK) : the function has issue to perform this action
  */
-Std_ReturnType CCP_Capture_Mode_Read_Value(uint16 *capture_value){
+Std_ReturnType CCP_Capture_Mode_Read_Value(const ccp_t *_ccp_obj, uint16 *capture_value){
     Std_ReturnType retVal = E_NOT_OK;
     CCP_REG_T capture_temp_value = {.ccpr_low = 0, .ccpr_high = 0};
-    if(NULL == capture_value){
+    if((NULL == _ccp_obj) || (NULL == capture_value)){
         retVal = E_NOT_OK;
     }
     else{
+        retVal = E_OK;
         /* Copy captured value */
-        capture_temp_value.ccpr_low = CCPR1L;
-        capture_temp_value.ccpr_high = CCPR1H;
+        if(CCP1_INST == _ccp_obj->ccp_inst){
+            capture_temp_value.ccpr_low = CCPR1L;
+            capture_temp_value.ccpr_high = CCPR1H;
+        }
+        else if(CCP2_INST == _ccp_obj->ccp_inst){
+            capture_temp_value.ccpr_low = CCPR2L;
+            capture_temp_value.ccpr_high = CCPR2H;
+        }
+        else{
+            retVal = E_NOT_OK;
+        }
         /* Write the 16-bit capture value */
         *capture_value = capture_temp_value.ccpr_16Bit;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Change the capture edge at run time, the false capture the change may flag is cleared
+ * @param _ccp_obj pointer to the CCP module configurations
+ * @param _capture_variant CCP_CAPTURE_MODE_xxx or CCP_MODULE_DISABLE to stop capturing
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType CCP_Capture_Mode_Select(const ccp_t *_ccp_obj, uint8 _capture_variant){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _ccp_obj){
+        retVal = E_NOT_OK;
+    }
+    else if((CCP_MODULE_DISABLE != _capture_variant) &&
+            ((CCP_CAPTURE_MODE_1_FALLING_EDGE > _capture_variant) || (CCP_CAPTURE_MODE_16_RISING_EDGE < _capture_variant))){
+        retVal = E_NOT_OK;
+    }
+    else{
         retVal = E_OK;
+        /* A capture mode change can set the flag : the interrupt is masked around it and the flag cleared after */
+        if(CCP1_INST == _ccp_obj->ccp_inst){
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            CCP1_InterruptDisable();
+#endif
+            CCP1_SET_MODE(_capture_variant);
+            CCP1_InterruptFlagClear();
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            CCP1_InterruptEnable();
+#endif
+        }
+        else if(CCP2_INST == _ccp_obj->ccp_inst){
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            CCP2_InterruptDisable();
+#endif
+            CCP2_SET_MODE(_capture_variant);
+            CCP2_InterruptFlagClear();
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+            CCP2_InterruptEnable();
+#endif
+        }
+        else{
+            retVal = E_NOT_OK;
+        }
     }
     return retVal;
 }
@@ -256,7 +319,7 @@ Std_ReturnType CCP_PWM_Set_Duty(const ccp_t *_ccp_obj, const uint8 _duty){
         retVal = E_NOT_OK;
     }
     else{
-        l_duty_temp = (uint16)(4 * (PR2 + 1) * (_duty / 100.0));
+        l_duty_temp = (uint16)((4UL * (PR2 + 1UL) * _duty) / 100UL);
         
         if(CCP1_INST == _ccp_obj->ccp_inst){
             CCP1CONbits.DC1B = (uint8)(l_duty_temp & 0x0003);
@@ -321,6 +384,46 @@ Std_ReturnType CCP_PWM_Stop(const ccp_t *_ccp_obj){
     return retVal;
 }
 
+/**
+ * @brief Set the PWM frequency, the smallest Timer2 pre-scaler fitting the period is selected
+ *        for the finest duty resolution , the duty cycle must be set again afterwards
+ * @note PR2 and the Timer2 pre-scaler are shared by the CCP1 and CCP2 PWM outputs
+ * @param _ccp_obj pointer to the CCP module configurations
+ * @param _frequency PWM frequency in Hz
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (frequency out of range)
+ */
+Std_ReturnType CCP_PWM_Set_Frequency(const ccp_t *_ccp_obj, uint32 _frequency){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint32 l_counts = 0;
+    
+    if((NULL == _ccp_obj) || (0 == _frequency)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* Timer2 input clocks (FOSC/4) per PWM period , rounded to the nearest */
+        l_counts = ((_XTAL_FREQ / 4UL) + (_frequency / 2UL)) / _frequency;
+        retVal = E_OK;
+        if((1UL <= l_counts) && (256UL >= l_counts)){
+            T2CONbits.T2CKPS = 0;
+            PR2 = (uint8)(l_counts - 1UL);
+        }
+        else if((256UL * 4UL) >= l_counts){
+            T2CONbits.T2CKPS = 1;
+            PR2 = (uint8)(((l_counts + 2UL) / 4UL) - 1UL);
+        }
+        else if((256UL * 16UL) >= l_counts){
+            T2CONbits.T2CKPS = 2;
+            PR2 = (uint8)(((l_counts + 8UL) / 16UL) - 1UL);
+        }
+        else{
+            retVal = E_NOT_OK;
+        }
+    }
+    return retVal;
+}
+
 #endif
 
 
@@ -342,61 +445,66 @@ static void CCP_PWM_Mode_Config(const ccp_t *_ccp_obj){
     }
     else{ /* Nothing */ }
            
-    /* PWM Frequency Initialization */
-    PR2 = (uint8)((_XTAL_FREQ / (_ccp_obj->PWM_Frequency * 4.0 * _ccp_obj->timer2_prescaler_value * 
-                    _ccp_obj->timer2_postscaler_value)) - 1);
+    /* PWM Frequency Initialization , the post-scaler does not take part in the PWM period */
+    (void)CCP_PWM_Set_Frequency(_ccp_obj, _ccp_obj->PWM_Frequency);
 }
 #endif
 
 static void CCP_Interrupt_Config(const ccp_t *_ccp_obj){
 /* CCP1 Interrupt Configurations */ 
 #if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-    CCP1_InterruptEnable();
-    CCP1_InterruptFlagClear();
-    CCP1_InterruptHandler = _ccp_obj->CCP1_InterruptHandler;
+    if(CCP1_INST == _ccp_obj->ccp_inst){
+        CCP1_InterruptEnable();
+        CCP1_InterruptFlagClear();
+        CCP1_InterruptHandler = _ccp_obj->CCP1_InterruptHandler;
 /* Interrupt Priority Configurations */
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE 
-    INTERRUPT_PriorityLevelsEnable();
-    if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP1_priority){
-        /* Enables all high-priority interrupts */
-        INTERRUPT_GlobalInterruptHighEnable();
-        CCP1_HighPrioritySet();
-    }
-    else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP1_priority){
-        /* Enables all unmasked peripheral interrupts */
-        INTERRUPT_GlobalInterruptLowEnable();
-        CCP1_LowPrioritySet();
-    }
-    else{ /* Nothing */ }
+        INTERRUPT_PriorityLevelEnable();
+        if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP1_priority){
+            /* Enables all high-priority interrupts */
+            INTERRUPT_GlobalInterruptHighEnable();
+            CCP1_HighPrioritySet();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP1_priority){
+            /* Enables all unmasked peripheral interrupts */
+            INTERRUPT_GlobalInterruptLowEnable();
+            CCP1_LowPrioritySet();
+        }
+        else{ /* Nothing */ }
 #else
-    INTERRUPT_GlobalInterruptEnable();
-    INTERRUPT_PeripheralInterruptEnable();
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
 #endif          
+    }
+    else{ /* Nothing */ }
 #endif    
         
 /* CCP2 Interrupt Configurations */ 
 #if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-    CCP2_InterruptEnable();
-    CCP2_InterruptFlagClear();
-    CCP2_InterruptHandler = _ccp_obj->CCP2_InterruptHandler;
+    if(CCP2_INST == _ccp_obj->ccp_inst){
+        CCP2_InterruptEnable();
+        CCP2_InterruptFlagClear();
+        CCP2_InterruptHandler = _ccp_obj->CCP2_InterruptHandler;
 /* Interrupt Priority Configurations */
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE 
-    INTERRUPT_PriorityLevelsEnable();
-    if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP2_priority){
-        /* Enables all high-priority interrupts */
-        INTERRUPT_GlobalInterruptHighEnable();
-        CCP2_HighPrioritySet();
-    }
-    else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP2_priority){
-        /* Enables all unmasked peripheral interrupts */
-        INTERRUPT_GlobalInterruptLowEnable();
-        CCP2_LowPrioritySet();
-    }
-    else{ /* Nothing */ }
+        INTERRUPT_PriorityLevelEnable();
+        if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP2_priority){
+            /* Enables all high-priority interrupts */
+            INTERRUPT_GlobalInterruptHighEnable();
+            CCP2_HighPrioritySet();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP2_priority){
+            /* Enables all unmasked peripheral interrupts */
+            INTERRUPT_GlobalInterruptLowEnable();
+            CCP2_LowPrioritySet();
+        }
+        else{ /* Nothing */ }
 #else
-    INTERRUPT_GlobalInterruptEnable();
-    INTERRUPT_PeripheralInterruptEnable();
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
 #endif          
+    }
+    else{ /* Nothing */ }
 #endif 
 }
 
@@ -488,16 +596,24 @@ static Std_ReturnType CCP_Compare_Mode_Config(const ccp_t *_ccp_obj){
 
 void CCP1_ISR(void){
     CCP1_InterruptFlagClear();
+#ifdef CCP1_INTERRUPT_HANDLER
+    CCP1_INTERRUPT_HANDLER();
+#else
     if(CCP1_InterruptHandler){
         CCP1_InterruptHandler();
     }
     else{ /* Nothing */ }
+#endif
 }
 
 void CCP2_ISR(void){
     CCP2_InterruptFlagClear();
+#ifdef CCP2_INTERRUPT_HANDLER
+    CCP2_INTERRUPT_HANDLER();
+#else
     if(CCP2_InterruptHandler){
         CCP2_InterruptHandler();
     }
     else{ /* Nothing */ }
+#endif
 }
@@ -114,9 +114,7 @@ typedef struct{
     pin_config_t ccp_pin;      /* CCP Pin I/O configurations */
     ccp_capture_timer_t ccp_capture_timer;
 #if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
-    uint32 PWM_Frequency;      /* CCP PWM mode frequency */
-    uint8 timer2_postscaler_value : 4;
-    uint8 timer2_prescaler_value : 2;
+    uint32 PWM_Frequency;      /* CCP PWM mode frequency , the Timer2 pre-scaler is selected from it */
 #endif
 #if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
     void (* CCP1_InterruptHandler)(void);   /* Call back used for all CCP1 Modes */
@@ -159,12 +157,22 @@ Std_ReturnType CCP_DeInit(const ccp_t *_ccp_obj);
 Std_ReturnType CCP_Is_Captured_Data_Ready(const ccp_t *_ccp_obj, uint8 *_capture_status);
 /**
  * @brief Read a value in capture mode
+ * @param _ccp_obj pointer to the CCP module configurations
  * @param capture_value pointer to the data to be read
  * @return status of the function
  *          (E_OK) : the function done successfully
  *          (E_NOT_OK) : the function has issue to perform this action
  */
-Std_ReturnType CCP_Capture_Mode_Read_Value(uint16 *capture_value);
+Std_ReturnType CCP_Capture_Mode_Read_Value(const ccp_t *_ccp_obj, uint16 *capture_value);
+/**
+ * @brief Change the capture edge at run time, the false capture the change may flag is cleared
+ * @param _ccp_obj pointer to the CCP module configurations
+ * @param _capture_variant CCP_CAPTURE_MODE_xxx or CCP_MODULE_DISABLE to stop capturing
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType CCP_Capture_Mode_Select(const ccp_t *_ccp_obj, uint8 _capture_variant);
 #endif
 
 
@@ -213,6 +221,17 @@ Std_ReturnType CCP_PWM_Start(const ccp_t *_ccp_obj);
  *          (E_NOT_OK) : the function has issue to perform this action
  */
 Std_ReturnType CCP_PWM_Stop(const ccp_t *_ccp_obj);
+/**
+ * @brief Set the PWM frequency, the smallest Timer2 pre-scaler fitting the period is selected
+ *        for the finest duty resolution , the duty cycle must be set again afterwards
+ * @note PR2 and the Timer2 pre-scaler are shared by the CCP1 and CCP2 PWM outputs
+ * @param _ccp_obj pointer to the CCP module configurations
+ * @param _frequency PWM frequency in Hz
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action (frequency out of range)
+ */
+Std_ReturnType CCP_PWM_Set_Frequency(const ccp_t *_ccp_obj, uint32 _frequency);
 #endif
 
 
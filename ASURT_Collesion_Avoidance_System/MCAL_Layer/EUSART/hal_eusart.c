@@ -9,18 +9,61 @@
 
 #if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
 static void(* EUSART_TxInterruptHandler)(void) = NULL;
+#ifdef EUSART_TX_INTERRUPT_HANDLER
+void EUSART_TX_INTERRUPT_HANDLER(void);
+#endif
 #endif
 
 #if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
 static void(* EUSART_RxInterruptHandler)(void) = NULL;
 static void(* EUSART_FramingErrorHandler)(void) = NULL;
 static void(* EUSART_OverrunErrorHandler)(void) = NULL;
+#ifdef EUSART_RX_INTERRUPT_HANDLER
+void EUSART_RX_INTERRUPT_HANDLER(void);
+#endif
+#endif
+
+/* Receive errors latched by the RX path, read and cleared through EUSART_ASYNC_Get_Error_Status() */
+static volatile eusart_error_status_t eusart_error_status = {.status = 0};
+static volatile eusart_error_counters_t eusart_error_counters = {0};
+
+#if EUSART_RX_BUFFER_CONFIGURATION==CONFIG_ENABLE
+/* Receive ring buffer : the head is only written by EUSART_Rx_ISR and the tail only by the reader,
+   both are free running 8-bit counters so a full buffer can use every slot */
+static volatile uint8 eusart_rx_buffer[EUSART_RX_BUFFER_SIZE];
+static volatile uint8 eusart_rx_head = 0;
+static volatile uint8 eusart_rx_tail = 0;
+static volatile uint8 eusart_rx_dropped = 0;
+#endif
+
+#if EUSART_TX_QUEUE_CONFIGURATION==CONFIG_ENABLE
+/* Transmit queue : the head is only written by the writer and the tail only by EUSART_Tx_ISR */
+static volatile uint8 eusart_tx_queue[EUSART_TX_QUEUE_SIZE];
+static volatile uint8 eusart_tx_head = 0;
+static volatile uint8 eusart_tx_tail = 0;
+/* Completion callback of the last queued buffer and the tail value that completes it */
+static void(* volatile eusart_tx_done_callback)(void) = NULL;
+static volatile uint8 eusart_tx_done_index = 0;
 #endif
 
+#if EUSART_MULTIDROP_CONFIGURATION==CONFIG_ENABLE
+/* Address filtering state, copied from the configurations by EUSART_ASYNC_RX_Init() */
+static uint8 eusart_node_address = 0;
+static uint8 eusart_address_detect = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE;
+#endif
+
+#if EUSART_AUTO_BAUD_CONFIGURATION==CONFIG_ENABLE
+static volatile uint8 eusart_auto_baud_status = EUSART_AUTO_BAUD_IDLE;
+#endif
 
 static Std_ReturnType EUSART_Baud_Rate_Calculation(const eusart_t *_eusart_obj);
 static Std_ReturnType EUSART_ASYNC_TX_Init(const eusart_t *_eusart_obj);
 static Std_ReturnType EUSART_ASYNC_RX_Init(const eusart_t *_eusart_obj);
+static void EUSART_Framing_Error_Detected(void);
+static void EUSART_Overrun_Error_Check(void);
+#if EUSART_AUTO_BAUD_CONFIGURATION==CONFIG_ENABLE
+static void EUSART_Auto_Baud_Complete(void);
+#endif
 
 /**
  * @brief Initialize EUSART module
@@ -92,8 +135,20 @@ Std_ReturnType EUSART_ASYNC_Read_Byte_Blocking(const eusart_t *_eusart_obj , uin
         retVal = E_NOT_OK;
     }
     else{
-        while(!PIR1bits.RCIF);
+#if EUSART_RX_BUFFER_CONFIGURATION==CONFIG_ENABLE
+        while(eusart_rx_head == eusart_rx_tail);
+        *_data = eusart_rx_buffer[eusart_rx_tail & EUSART_RX_BUFFER_MASK];
+        eusart_rx_tail++;
+#else
+        while(!PIR1bits.RCIF){
+            EUSART_Overrun_Error_Check();
+        }
+        if(RCSTAbits.FERR){
+            EUSART_Framing_Error_Detected();
+        }
+        else{ /* Nothing */ }
         *_data = RCREG;
+#endif
         retVal = E_OK;
     }
     return retVal;
@@ -112,10 +167,23 @@ Std_ReturnType EUSART_ASYNC_Read_Byte_Non_Blocking(const eusart_t *_eusart_obj ,
         retVal = E_NOT_OK;
     }
     else{
+#if EUSART_RX_BUFFER_CONFIGURATION==CONFIG_ENABLE
+        if(eusart_rx_head != eusart_rx_tail){
+            *_data = eusart_rx_buffer[eusart_rx_tail & EUSART_RX_BUFFER_MASK];
+            eusart_rx_tail++;
+            retVal = E_OK;
+        }
+#else
+        EUSART_Overrun_Error_Check();
         if(1 == PIR1bits.RCIF){
+            if(RCSTAbits.FERR){
+                EUSART_Framing_Error_Detected();
+            }
+            else{ /* Nothing */ }
             *_data = RCREG;
             retVal = E_OK;
         }
+#endif
         else{
             retVal = E_NOT_OK;
         }
@@ -138,9 +206,168 @@ Std_ReturnType EUSART_ASYNC_RX_Restart(const eusart_t *_eusart_obj){
     else{
         RCSTAbits.CREN = 0;
         RCSTAbits.CREN = 1;
+        if(eusart_error_counters.rx_restarts < 0xFFFF){
+            eusart_error_counters.rx_restarts++;
+        }
+        else{ /* Nothing */ }
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Get the FERR/OERR status latched by the RX path since the last call, then clear it
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _error_status latched error flags (eusart_ferr / eusart_oerr)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Get_Error_Status(const eusart_t *_eusart_obj , eusart_error_status_t *_error_status){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_rx_interrupt = 0;
+    if((NULL == _eusart_obj) || (NULL == _error_status)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_rx_interrupt = PIE1bits.RCIE;
+        PIE1bits.RCIE = 0;
+        _error_status->status = eusart_error_status.status;
+        eusart_error_status.status = 0;
+        PIE1bits.RCIE = l_rx_interrupt;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Get the receive error counters
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _counters copy of the framing error, overrun and receiver restart counters
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Get_Error_Counters(const eusart_t *_eusart_obj , eusart_error_counters_t *_counters){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_rx_interrupt = 0;
+    if((NULL == _eusart_obj) || (NULL == _counters)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* The counters are 16-bit and updated by the RX ISR, copy them with the RX interrupt masked */
+        l_rx_interrupt = PIE1bits.RCIE;
+        PIE1bits.RCIE = 0;
+        _counters->framing_errors = eusart_error_counters.framing_errors;
+        _counters->overrun_errors = eusart_error_counters.overrun_errors;
+        _counters->rx_restarts = eusart_error_counters.rx_restarts;
+        PIE1bits.RCIE = l_rx_interrupt;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Reset the receive error counters
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Clear_Error_Counters(const eusart_t *_eusart_obj){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_rx_interrupt = 0;
+    if(NULL == _eusart_obj){
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_rx_interrupt = PIE1bits.RCIE;
+        PIE1bits.RCIE = 0;
+        eusart_error_counters.framing_errors = 0;
+        eusart_error_counters.overrun_errors = 0;
+        eusart_error_counters.rx_restarts = 0;
+        PIE1bits.RCIE = l_rx_interrupt;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+#if EUSART_RX_BUFFER_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Get the number of received bytes waiting in the receive ring buffer
+ * @note The ring buffer is filled by EUSART_Rx_ISR, the RX interrupt must be enabled in the configurations
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _available number of bytes ready to be read
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Available(const eusart_t *_eusart_obj , uint8 *_available){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _eusart_obj) || (NULL == _available)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_available = (uint8)(eusart_rx_head - eusart_rx_tail);
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Reading up to _length bytes from the receive ring buffer without blocking the CPU
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _data pointer to the destination buffer
+ * @param _length maximum number of bytes to be read
+ * @param _read_length number of bytes actually read
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Read_Buffer(const eusart_t *_eusart_obj , uint8 *_data , uint8 _length , uint8 *_read_length){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_head = 0;
+    uint8 l_tail = 0;
+    uint8 l_count = 0;
+    if((NULL == _eusart_obj) || (NULL == _data) || (NULL == _read_length)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* Take one snapshot of the head, bytes arriving meanwhile are left for the next call */
+        l_head = eusart_rx_head;
+        l_tail = eusart_rx_tail;
+        while((l_tail != l_head) && (l_count < _length)){
+            _data[l_count] = eusart_rx_buffer[l_tail & EUSART_RX_BUFFER_MASK];
+            l_tail++;
+            l_count++;
+        }
+        eusart_rx_tail = l_tail;
+        *_read_length = l_count;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Get the number of received bytes dropped because the receive ring buffer was full
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _dropped number of dropped bytes (saturates at 255)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Get_Dropped_Bytes(const eusart_t *_eusart_obj , uint8 *_dropped){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _eusart_obj) || (NULL == _dropped)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_dropped = eusart_rx_dropped;
+        retVal = E_OK;
     }
     return retVal;
 }
+#endif
 
 
 
@@ -162,6 +389,7 @@ Std_ReturnType EUSART_ASYNC_Write_Byte_Blocking(const eusart_t *_eusart_obj , ui
 #if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
         EUSART_TX_InterruptEnable();
 #endif
+        TXSTAbits.TX9D = 0;
         TXREG = _data;
         retVal = E_OK;
     }
@@ -199,6 +427,7 @@ Std_ReturnType EUSART_ASYNC_Write_Byte_Non_Blocking(const eusart_t *_eusart_obj
 #if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
         EUSART_TX_InterruptEnable();
 #endif
+        TXSTAbits.TX9D = 0;
         TXREG = _data;
         retVal = E_OK;
         }
@@ -229,62 +458,511 @@ Std_ReturnType EUSART_ASYNC_Write_String_Non_Blocking(const eusart_t *_eusart_ob
     return retVal;
 }
 
+#if EUSART_TX_QUEUE_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Queue a buffer to be sent by the TX interrupt, one byte per TX interrupt
+ * @note The whole buffer is queued or nothing is, the call never blocks the CPU.
+ *       The callback runs from interrupt context once the last byte of the buffer is loaded in TXREG.
+ *       Only one completion callback can be pending at a time.
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _data pointer to the bytes to be sent (copied into the transmit queue)
+ * @param _length number of bytes to be sent
+ * @param _done_callback called when the buffer is handed to the hardware, can be NULL
+ * @return status of the function
+ *          (E_OK) : the buffer is queued
+ *          (E_NOT_OK) : the queue has no room for the buffer or a completion callback is still pending
+ */
+Std_ReturnType EUSART_ASYNC_Write_Buffer_Async(const eusart_t *_eusart_obj , const uint8 *_data , uint8 _length , void (*_done_callback)(void)){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_head = 0;
+    uint8 l_counter = 0;
+    if((NULL == _eusart_obj) || (NULL == _data) || (0 == _length)){
+        retVal = E_NOT_OK;
+    }
+    else if((uint8)(EUSART_TX_QUEUE_SIZE - (uint8)(eusart_tx_head - eusart_tx_tail)) < _length){
+        /* Back-pressure : not enough room for the whole buffer */
+        retVal = E_NOT_OK;
+    }
+    else if((NULL != _done_callback) && (NULL != eusart_tx_done_callback)){
+        /* Back-pressure : the completion of the previous buffer was not reported yet */
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_head = eusart_tx_head;
+        for(l_counter = 0 ; l_counter < _length ; l_counter++){
+            eusart_tx_queue[l_head & EUSART_TX_QUEUE_MASK] = _data[l_counter];
+            l_head++;
+        }
+        if(NULL != _done_callback){
+            eusart_tx_done_index = l_head;
+            eusart_tx_done_callback = _done_callback;
+        }
+        /* Publish the bytes then let the TX interrupt drain them */
+        eusart_tx_head = l_head;
+        EUSART_TX_InterruptEnable();
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Get the free space in the transmit queue
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _free number of bytes that can be queued
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Tx_Queue_Free(const eusart_t *_eusart_obj , uint8 *_free){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _eusart_obj) || (NULL == _free)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_free = (uint8)(EUSART_TX_QUEUE_SIZE - (uint8)(eusart_tx_head - eusart_tx_tail));
+        retVal = E_OK;
+    }
+    return retVal;
+}
+#endif
+
+#if EUSART_MULTIDROP_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Send a multi-drop address byte (9th bit set), the following data bytes select only that node
+ * @note The transmitter must be configured with eusart_tx_9bit_enable, the transmit queue has to be empty
+ *       and the call waits at most one character time for TXREG to be free
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _address address of the destination node, EUSART_BROADCAST_ADDRESS selects every node
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Write_Address(const eusart_t *_eusart_obj , uint8 _address){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _eusart_obj) || (EUSART_ASYNCHRONOUS_9Bit_TX_DISABLE == _eusart_obj->eusart_tx_cfg.eusart_tx_9bit_enable)){
+        retVal = E_NOT_OK;
+    }
+#if EUSART_TX_QUEUE_CONFIGURATION==CONFIG_ENABLE
+    else if(eusart_tx_head != eusart_tx_tail){
+        /* The address must not overtake the data of the previous message */
+        retVal = E_NOT_OK;
+    }
+#endif
+    else{
+        while(!PIR1bits.TXIF);
+        TXSTAbits.TX9D = 1;
+        TXREG = _address;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Ignore the data bytes until the next address byte, ends the current multi-drop message
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Address_Detect_Resume(const eusart_t *_eusart_obj){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _eusart_obj){
+        retVal = E_NOT_OK;
+    }
+    else{
+        if(EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE == eusart_address_detect){
+            RCSTAbits.ADDEN = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE;
+        }
+        else{ /* Nothing */ }
+        retVal = E_OK;
+    }
+    return retVal;
+}
+#endif
+
+#if EUSART_AUTO_BAUD_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Arm the auto-baud detection, the next received 0x55 ('U') character sets the baud rate generator
+ * @note The generator is switched to BAUDRATE_ASYN_16BIT_HIGH_SPEED for the best resolution,
+ *       the measurement character is never stored in the receive buffer
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Auto_Baud_Start(const eusart_t *_eusart_obj){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _eusart_obj){
+        retVal = E_NOT_OK;
+    }
+    else{
+        TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED;
+        BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
+        BAUDCONbits.ABDOVF = 0;
+        eusart_auto_baud_status = EUSART_AUTO_BAUD_BUSY;
+        BAUDCONbits.ABDEN = 1;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Get the state of the auto-baud detection
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _status EUSART_AUTO_BAUD_IDLE, EUSART_AUTO_BAUD_BUSY, EUSART_AUTO_BAUD_DONE or EUSART_AUTO_BAUD_OVERFLOW
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Auto_Baud_Status(const eusart_t *_eusart_obj , uint8 *_status){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _eusart_obj) || (NULL == _status)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* Without the RX interrupt the measurement has to be completed here */
+        if((EUSART_AUTO_BAUD_BUSY == eusart_auto_baud_status) && (0 == BAUDCONbits.ABDEN) && (PIR1bits.RCIF)){
+            EUSART_Auto_Baud_Complete();
+        }
+        else{ /* Nothing */ }
+        *_status = eusart_auto_baud_status;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Read the baud rate generator value set by the last auto-baud measurement
+ * @note The value is in the BAUDRATE_ASYN_16BIT_HIGH_SPEED mode the measurement runs in
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _brg_value the SPBRGH:SPBRG value
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Auto_Baud_Get_Brg(const eusart_t *_eusart_obj , uint16 *_brg_value){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _eusart_obj) || (NULL == _brg_value)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        *_brg_value = (uint16)(((uint16)SPBRGH << 8) | SPBRG);
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Change the baud rate at run time, waits for the character being shifted out to complete
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _baudrate_config one of the asynchronous baudrate_gen_t modes
+ * @param _brg_value SPBRGH:SPBRG value, computed with EUSART_BRG_BEST_VALUE()
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Set_Baud_Rate(const eusart_t *_eusart_obj , baudrate_gen_t _baudrate_config , uint16 _brg_value){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _eusart_obj) || (_baudrate_config > BAUDRATE_ASYN_16BIT_HIGH_SPEED)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* Let the transmit shift register empty before the bit time changes */
+        while(!TXSTAbits.TRMT);
+        BAUDCONbits.ABDEN = 0;
+        eusart_auto_baud_status = EUSART_AUTO_BAUD_IDLE;
+        TXSTAbits.BRGH = (BAUDRATE_ASYN_8BIT_HIGH_SPEED == _baudrate_config) || (BAUDRATE_ASYN_16BIT_HIGH_SPEED == _baudrate_config);
+        BAUDCONbits.BRG16 = (BAUDRATE_ASYN_16BIT_lOW_SPEED == _baudrate_config) || (BAUDRATE_ASYN_16BIT_HIGH_SPEED == _baudrate_config);
+        SPBRG = (uint8)(_brg_value);
+        SPBRGH = (uint8)(_brg_value >> 8);
+        retVal = E_OK;
+    }
+    return retVal;
+}
+#endif
+
+#if EUSART_SYNCHRONOUS_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Initialize EUSART module in synchronous master or slave mode
+ * @note RC6 is the clock (CK) and RC7 the data line (DT), the module starts idle in transmit direction.
+ *       baudrate_config must be BAUDRATE_SYN_8BIT or BAUDRATE_SYN_16BIT, the master loads EUSART_BRG_SYNC_VALUE()
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Init(const eusart_t *_eusart_obj){
+    Std_ReturnType retVal = E_NOT_OK;
+    if((NULL == _eusart_obj) || ((BAUDRATE_SYN_8BIT != _eusart_obj->baudrate_config) && (BAUDRATE_SYN_16BIT != _eusart_obj->baudrate_config))){
+        retVal = E_NOT_OK;
+    }
+    else{
+        /* Disable the EUSART module */
+        RCSTAbits.SPEN = EUSART_MODULE_DISABLE;
+        /* RC6 (CK) and RC7 (DT) are driven by the module */
+        TRISCbits.RC7 = 1;
+        TRISCbits.RC6 = 1;
+        /* SYNC = 1 and the clock generator, only used by the master */
+        retVal = EUSART_Baud_Rate_Calculation(_eusart_obj);
+        TXSTAbits.CSRC = _eusart_obj->eusart_sync_cfg.eusart_sync_role;
+        BAUDCONbits.SCKP = _eusart_obj->eusart_sync_cfg.eusart_sync_clock_idle;
+        /* Interrupts, handlers and 9-bit settings are shared with the asynchronous mode */
+        retVal = EUSART_ASYNC_TX_Init(_eusart_obj);
+        retVal = EUSART_ASYNC_RX_Init(_eusart_obj);
+        /* Reception has priority over transmission on the shared data line, start idle */
+        RCSTAbits.CREN = 0;
+        RCSTAbits.SREN = 0;
+        /* Enable the EUSART module */
+        RCSTAbits.SPEN = EUSART_MODULE_ENABLE;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief DeInitialize the synchronous EUSART module
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_DeInit(const eusart_t *_eusart_obj){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _eusart_obj){
+        retVal = E_NOT_OK;
+    }
+    else{
+        RCSTAbits.SPEN = EUSART_MODULE_DISABLE;
+        RCSTAbits.CREN = 0;
+        RCSTAbits.SREN = 0;
+        TXSTAbits.CSRC = EUSART_SYNC_SLAVE;
+        TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Turn the half-duplex data line to transmit, waits for a pending reception to be cancelled
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Transmit_Mode(const eusart_t *_eusart_obj){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _eusart_obj){
+        retVal = E_NOT_OK;
+    }
+    else{
+        RCSTAbits.CREN = 0;
+        RCSTAbits.SREN = 0;
+        TXSTAbits.TXEN = EUSART_ASYNCHRONOUS_TX_ENABLE;
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Turn the half-duplex data line to receive
+ * @note Any character still being shifted out is completed first
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _reception EUSART_SYNC_SINGLE_RECEIVE (master only, one byte) or EUSART_SYNC_CONTINUOUS_RECEIVE
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Receive_Mode(const eusart_t *_eusart_obj , uint8 _reception){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(NULL == _eusart_obj){
+        retVal = E_NOT_OK;
+    }
+    else if((EUSART_SYNC_SINGLE_RECEIVE == _reception) && (EUSART_SYNC_SLAVE == _eusart_obj->eusart_sync_cfg.eusart_sync_role)){
+        /* SREN has no meaning without the clock */
+        retVal = E_NOT_OK;
+    }
+    else{
+        while(!TXSTAbits.TRMT);
+        if(EUSART_SYNC_CONTINUOUS_RECEIVE == _reception){
+            RCSTAbits.CREN = 1;
+        }
+        else{
+            RCSTAbits.SREN = 1;
+        }
+        retVal = E_OK;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Send a buffer and wait until its last bit is on the line
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _data pointer to the bytes to be sent
+ * @param _length number of bytes to be sent
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Write_Buffer_Blocking(const eusart_t *_eusart_obj , const uint8 *_data , uint8 _length){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_counter = 0;
+    if((NULL == _eusart_obj) || (NULL == _data)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        retVal = EUSART_SYNC_Transmit_Mode(_eusart_obj);
+        for(l_counter = 0 ; l_counter < _length ; l_counter++){
+            while(!PIR1bits.TXIF);
+            TXSTAbits.TX9D = 0;
+            TXREG = _data[l_counter];
+        }
+        while(!TXSTAbits.TRMT);
+    }
+    return retVal;
+}
+
+/**
+ * @brief Receive a buffer, the master clocks in exactly _length bytes
+ * @note The slave stays in continuous reception after the call
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _data pointer to the destination buffer
+ * @param _length number of bytes to be received
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Read_Buffer_Blocking(const eusart_t *_eusart_obj , uint8 *_data , uint8 _length){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_counter = 0;
+    if((NULL == _eusart_obj) || (NULL == _data)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        retVal = E_OK;
+        if(EUSART_SYNC_SLAVE == _eusart_obj->eusart_sync_cfg.eusart_sync_role){
+            retVal = EUSART_SYNC_Receive_Mode(_eusart_obj , EUSART_SYNC_CONTINUOUS_RECEIVE);
+        }
+        else{ /* Nothing */ }
+        for(l_counter = 0 ; (E_OK == retVal) && (l_counter < _length) ; l_counter++){
+            if(EUSART_SYNC_MASTER == _eusart_obj->eusart_sync_cfg.eusart_sync_role){
+                /* One SREN per byte so the master never clocks in more than asked */
+                retVal = EUSART_SYNC_Receive_Mode(_eusart_obj , EUSART_SYNC_SINGLE_RECEIVE);
+            }
+            else{ /* Nothing */ }
+            if(E_OK == retVal){
+                retVal = EUSART_ASYNC_Read_Byte_Blocking(_eusart_obj , &_data[l_counter]);
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    return retVal;
+}
+#endif
+
 /*--------------------------------- Helper Functions --------------------------------------*/
 
 static Std_ReturnType EUSART_Baud_Rate_Calculation(const eusart_t *_eusart_obj){
     Std_ReturnType retVal = E_NOT_OK;
-    float baud_rate_temp = 0;
     if(NULL == _eusart_obj){
         retVal = E_NOT_OK;
     }
     else{
+        retVal = E_OK;
         switch(_eusart_obj->baudrate_config){
             case BAUDRATE_ASYN_8BIT_lOW_SPEED : 
                 TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
                 TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_LOW_SPEED;
                 BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
-                baud_rate_temp = ((_XTAL_FREQ / (float)(_eusart_obj->baudrate)) / 64) - 1;
                 break;
             case BAUDRATE_ASYN_8BIT_HIGH_SPEED : 
                 TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
                 TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED;
                 BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
-                baud_rate_temp = ((_XTAL_FREQ / (float)(_eusart_obj->baudrate)) / 16) - 1;
                 break;
             case BAUDRATE_ASYN_16BIT_lOW_SPEED : 
                 TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
                 TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_LOW_SPEED;
                 BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
-                baud_rate_temp = ((_XTAL_FREQ / (float)(_eusart_obj->baudrate)) / 16) - 1;
                 break;
             case BAUDRATE_ASYN_16BIT_HIGH_SPEED : 
                 TXSTAbits.SYNC = EUSART_ASYNCHRONOUS_MODE;
                 TXSTAbits.BRGH = EUSART_ASYNCHRONOUS_HIGH_SPEED;
                 BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
-                baud_rate_temp = ((_XTAL_FREQ / (float)(_eusart_obj->baudrate)) / 4) - 1;
                 break;
             case BAUDRATE_SYN_8BIT : 
                 TXSTAbits.SYNC = EUSART_SYNCHRONOUS_MODE;
                 BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
-                baud_rate_temp = ((_XTAL_FREQ / (float)(_eusart_obj->baudrate)) / 4) - 1;
                 break;
             case BAUDRATE_SYN_16BIT : 
                 TXSTAbits.SYNC = EUSART_SYNCHRONOUS_MODE;
                 BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
-                baud_rate_temp = ((_XTAL_FREQ / (float)(_eusart_obj->baudrate)) / 4) - 1;
                 break;
             default:
                 retVal = E_NOT_OK;
         }
-        SPBRG = (uint8)((uint32)baud_rate_temp);
-        SPBRGH = (uint8)(((uint32)baud_rate_temp) >> 8);
-        retVal = E_OK;
+        /* The generator value is computed at compile time, only load it for a valid mode */
+        if(E_OK == retVal){
+            SPBRG = (uint8)(_eusart_obj->baudrate_brg_value);
+            SPBRGH = (uint8)(_eusart_obj->baudrate_brg_value >> 8);
+        }
+        else{ /* Nothing */ }
     }
     return retVal;
 }
 
 
 
+#if EUSART_AUTO_BAUD_CONFIGURATION==CONFIG_ENABLE
+static void EUSART_Auto_Baud_Complete(void){
+    uint8 l_dummy = 0;
+    /* The measurement character is meaningless, reading RCREG clears RCIF */
+    l_dummy = RCREG;
+    if(BAUDCONbits.ABDOVF){
+        BAUDCONbits.ABDOVF = 0;
+        eusart_auto_baud_status = EUSART_AUTO_BAUD_OVERFLOW;
+    }
+    else{
+        eusart_auto_baud_status = EUSART_AUTO_BAUD_DONE;
+    }
+}
+#endif
+
+static void EUSART_Framing_Error_Detected(void){
+    eusart_error_status.eusart_ferr = EUSART_FRAMING_ERROR_DETECTED;
+    if(eusart_error_counters.framing_errors < 0xFFFF){
+        eusart_error_counters.framing_errors++;
+    }
+    else{ /* Nothing */ }
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+    if(EUSART_FramingErrorHandler){
+        EUSART_FramingErrorHandler();
+    }
+#endif
+}
+
+static void EUSART_Overrun_Error_Check(void){
+    if(RCSTAbits.OERR){
+        /* The receiver is stopped until CREN is cycled, which also clears OERR */
+        RCSTAbits.CREN = 0;
+        RCSTAbits.CREN = 1;
+        eusart_error_status.eusart_oerr = EUSART_OVERRUN_ERROR_DETECTED;
+        if(eusart_error_counters.overrun_errors < 0xFFFF){
+            eusart_error_counters.overrun_errors++;
+        }
+        else{ /* Nothing */ }
+        if(eusart_error_counters.rx_restarts < 0xFFFF){
+            eusart_error_counters.rx_restarts++;
+        }
+        else{ /* Nothing */ }
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+        if(EUSART_OverrunErrorHandler){
+            EUSART_OverrunErrorHandler();
+        }
+#endif
+    }
+    else{ /* Nothing */ }
+}
+
 static Std_ReturnType EUSART_ASYNC_TX_Init(const eusart_t *_eusart_obj){
     Std_ReturnType retVal = E_NOT_OK;
     if(NULL == _eusart_obj){
@@ -296,30 +974,29 @@ static Std_ReturnType EUSART_ASYNC_TX_Init(const eusart_t *_eusart_obj){
             TXSTAbits.TXEN = EUSART_ASYNCHRONOUS_TX_ENABLE;
             
             /* EUSART Transmit Interrupt Configurations */
-            if(EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE == _eusart_obj->eusart_tx_cfg.eusart_tx_interrupt_enable){
-                PIE1bits.TX1IE = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
-                /* Configure the interrupts */
 #if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-        EUSART_TX_InterruptEnable();    /* Enable EUSART_TX module interrupt */
-        EUSART_TxInterruptHandler = _eusart_obj->EUSART_TxInterruptHandler;
-        /* Check priority & Enable EUSART_TX module interrupt */
+            /* Handler and priority are set even when TXIE starts cleared : the transmit queue sets TXIE
+               later and TXIF must then reach the vector that polls it , TXIP resets to high */
+            EUSART_TxInterruptHandler = _eusart_obj->EUSART_TxInterruptHandler;
         #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityLevelEnable();
-        if(INTERRUPT_HIGH_PRIORITY == _eusart_obj->eusart_tx_cfg.eusart_tx_interrupt_priority){
-            INTERRUPT_GlobalInterruptHighEnable();
-            EUSART_TX_HighPrioritySet();
-        }
-        else if(INTERRUPT_LOW_PRIORITY == _eusart_obj->eusart_tx_cfg.eusart_tx_interrupt_priority){
-            INTERRUPT_GlobalInterruptLowEnable();
-            EUSART_TX_LowPrioritySet();
-        }
+            INTERRUPT_PriorityLevelEnable();
+            if(INTERRUPT_HIGH_PRIORITY == _eusart_obj->eusart_tx_cfg.eusart_tx_interrupt_priority){
+                INTERRUPT_GlobalInterruptHighEnable();
+                EUSART_TX_HighPrioritySet();
+            }
+            else{
+                INTERRUPT_GlobalInterruptLowEnable();
+                EUSART_TX_LowPrioritySet();
+            }
         #else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
+            INTERRUPT_GlobalInterruptEnable();
+            INTERRUPT_PeripheralInterruptEnable();
         #endif
 #endif
+            if(EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE == _eusart_obj->eusart_tx_cfg.eusart_tx_interrupt_enable){
+                PIE1bits.TX1IE = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE;
             }
-            else if(EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE == _eusart_obj->eusart_tx_cfg.eusart_tx_interrupt_enable){
+            else{
                 PIE1bits.TX1IE = EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE;
             }
             
@@ -350,32 +1027,30 @@ static Std_ReturnType EUSART_ASYNC_RX_Init(const eusart_t *_eusart_obj){
             RCSTAbits.CREN = EUSART_ASYNCHRONOUS_RX_ENABLE;
             
             /* EUSART Receiver Interrupt Configurations */
-            if(EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE == _eusart_obj->eusart_rx_cfg.eusart_rx_interrupt_enable){
-                PIE1bits.RCIE = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
-                /* Configure the interrupts */
 #if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
-        EUSART_RX_InterruptEnable();    /* Enable EUSART_RX module interrupt */
-        EUSART_RxInterruptHandler = _eusart_obj->EUSART_RxInterruptHandler;
-        EUSART_FramingErrorHandler = _eusart_obj->EUSART_FramingErrorHandler;
-        EUSART_OverrunErrorHandler = _eusart_obj->EUSART_OverrunErrorHandler;
-        /* Check priority & Enable EUSART_RX module interrupt */
+            /* Handlers and priority are set even when RCIE starts cleared , RCIP resets to high */
+            EUSART_RxInterruptHandler = _eusart_obj->EUSART_RxInterruptHandler;
+            EUSART_FramingErrorHandler = _eusart_obj->EUSART_FramingErrorHandler;
+            EUSART_OverrunErrorHandler = _eusart_obj->EUSART_OverrunErrorHandler;
         #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityLevelEnable();
-        if(INTERRUPT_HIGH_PRIORITY == _eusart_obj->eusart_rx_cfg.eusart_rx_interrupt_priority){
-            INTERRUPT_GlobalInterruptHighEnable();
-            EUSART_RX_HighPrioritySet();
-        }
-        else if(INTERRUPT_LOW_PRIORITY == _eusart_obj->eusart_rx_cfg.eusart_rx_interrupt_priority){
-            INTERRUPT_GlobalInterruptLowEnable();
-            EUSART_RX_LowPrioritySet();
-        }
+            INTERRUPT_PriorityLevelEnable();
+            if(INTERRUPT_HIGH_PRIORITY == _eusart_obj->eusart_rx_cfg.eusart_rx_interrupt_priority){
+                INTERRUPT_GlobalInterruptHighEnable();
+                EUSART_RX_HighPrioritySet();
+            }
+            else{
+                INTERRUPT_GlobalInterruptLowEnable();
+                EUSART_RX_LowPrioritySet();
+            }
         #else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
+            INTERRUPT_GlobalInterruptEnable();
+            INTERRUPT_PeripheralInterruptEnable();
         #endif
 #endif
+            if(EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE == _eusart_obj->eusart_rx_cfg.eusart_rx_interrupt_enable){
+                PIE1bits.RCIE = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE;
             }
-            else if(EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE == _eusart_obj->eusart_rx_cfg.eusart_rx_interrupt_enable){
+            else{
                 PIE1bits.RCIE = EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE;
             }
             /* EUSART Receiver 9-Bit Configurations */
@@ -385,6 +1060,19 @@ static Std_ReturnType EUSART_ASYNC_RX_Init(const eusart_t *_eusart_obj){
             else if(EUSART_ASYNCHRONOUS_9Bit_RX_DISABLE == _eusart_obj->eusart_rx_cfg.eusart_rx_9bit_enable){
                 RCSTAbits.RX9 = EUSART_ASYNCHRONOUS_9Bit_RX_DISABLE;
             }
+#if EUSART_MULTIDROP_CONFIGURATION==CONFIG_ENABLE
+            /* EUSART Receiver Address Detection, only bytes with the 9th bit set raise RCIF */
+            eusart_node_address = _eusart_obj->node_address;
+            if((EUSART_ASYNCHRONOUS_9Bit_RX_ENABLE == _eusart_obj->eusart_rx_cfg.eusart_rx_9bit_enable) &&
+               (EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE == _eusart_obj->eusart_rx_cfg.eusart_rx_address_detect_enable)){
+                eusart_address_detect = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE;
+                RCSTAbits.ADDEN = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE;
+            }
+            else{
+                eusart_address_detect = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE;
+                RCSTAbits.ADDEN = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE;
+            }
+#endif
         
         }
         else {/* Nothing */}
@@ -396,19 +1084,90 @@ static Std_ReturnType EUSART_ASYNC_RX_Init(const eusart_t *_eusart_obj){
 /*--------------------------------------- ISRs -------------------------------------------*/
 
 void EUSART_Tx_ISR(void){
+#if EUSART_TX_QUEUE_CONFIGURATION==CONFIG_ENABLE
+    void (*l_done_callback)(void) = NULL;
+    /* TXREG is empty : load the next queued byte */
+    if(eusart_tx_head != eusart_tx_tail){
+        /* Queued bytes are data bytes, the 9th bit only marks addresses */
+        TXSTAbits.TX9D = 0;
+        TXREG = eusart_tx_queue[eusart_tx_tail & EUSART_TX_QUEUE_MASK];
+        eusart_tx_tail++;
+        if((eusart_tx_tail == eusart_tx_done_index) && (NULL != eusart_tx_done_callback)){
+            l_done_callback = eusart_tx_done_callback;
+            eusart_tx_done_callback = NULL;
+            l_done_callback();
+        }
+    }
+    /* Stop the TX interrupt once the queue is drained */
+    if(eusart_tx_head == eusart_tx_tail){
+        EUSART_TX_InterruptDisable();
+    }
+#else
     EUSART_TX_InterruptDisable();
+#endif
+#ifdef EUSART_TX_INTERRUPT_HANDLER
+    EUSART_TX_INTERRUPT_HANDLER();
+#else
     if(EUSART_TxInterruptHandler){
         EUSART_TxInterruptHandler();
     }
+#endif
 }
 void EUSART_Rx_ISR(void){
-    if(EUSART_RxInterruptHandler){
-        EUSART_RxInterruptHandler();
+#if EUSART_RX_BUFFER_CONFIGURATION==CONFIG_ENABLE
+    uint8 l_rx_data = 0;
+    uint8 l_framing_error = 0;
+#if EUSART_MULTIDROP_CONFIGURATION==CONFIG_ENABLE
+    uint8 l_ninth_bit = 0;
+#endif
+#endif
+#if EUSART_AUTO_BAUD_CONFIGURATION==CONFIG_ENABLE
+    /* RCIF after ABDEN self-clears flags the end of the auto-baud measurement */
+    if((EUSART_AUTO_BAUD_BUSY == eusart_auto_baud_status) && (0 == BAUDCONbits.ABDEN) && (PIR1bits.RCIF)){
+        EUSART_Auto_Baud_Complete();
     }
-    if(EUSART_FramingErrorHandler){
-        EUSART_FramingErrorHandler();
+    else{ /* Nothing */ }
+#endif
+#if EUSART_RX_BUFFER_CONFIGURATION==CONFIG_ENABLE
+    /* Drain the hardware receive FIFO, RCIF is cleared when RCREG becomes empty */
+    while(PIR1bits.RCIF){
+        /* FERR belongs to the character on top of the FIFO, sample it before RCREG is read */
+        l_framing_error = RCSTAbits.FERR;
+#if EUSART_MULTIDROP_CONFIGURATION==CONFIG_ENABLE
+        l_ninth_bit = RCSTAbits.RX9D;
+#endif
+        l_rx_data = RCREG;
+        if(l_framing_error){
+            EUSART_Framing_Error_Detected();
+        }
+#if EUSART_MULTIDROP_CONFIGURATION==CONFIG_ENABLE
+        else if((EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE == eusart_address_detect) && (l_ninth_bit)){
+            /* Address byte : take the data interrupts only while this node is selected */
+            if((eusart_node_address == l_rx_data) || (EUSART_BROADCAST_ADDRESS == l_rx_data)){
+                RCSTAbits.ADDEN = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE;
+            }
+            else{
+                RCSTAbits.ADDEN = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE;
+            }
+        }
+#endif
+        else if((uint8)(eusart_rx_head - eusart_rx_tail) < EUSART_RX_BUFFER_SIZE){
+            eusart_rx_buffer[eusart_rx_head & EUSART_RX_BUFFER_MASK] = l_rx_data;
+            eusart_rx_head++;
+        }
+        else if(eusart_rx_dropped < 0xFF){
+            eusart_rx_dropped++;
+        }
+        else{ /* Nothing */ }
     }
-    if(EUSART_OverrunErrorHandler){
-        EUSART_OverrunErrorHandler();
+#endif
+    /* Restart the receiver if the FIFO overran, the reader of RCREG handles FERR when unbuffered */
+    EUSART_Overrun_Error_Check();
+#ifdef EUSART_RX_INTERRUPT_HANDLER
+    EUSART_RX_INTERRUPT_HANDLER();
+#else
+    if(EUSART_RxInterruptHandler){
+        EUSART_RxInterruptHandler();
     }
-}
\ No newline at end of file
+#endif
+}
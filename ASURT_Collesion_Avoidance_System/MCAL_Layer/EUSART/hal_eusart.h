@@ -50,6 +50,21 @@
 /* EUSART 9-Bit Receiver Enable */
 #define EUSART_ASYNCHRONOUS_9Bit_RX_ENABLE   1
 #define EUSART_ASYNCHRONOUS_9Bit_RX_DISABLE  0
+/* EUSART Receiver Address Detection (9-Bit multi-drop) */
+#define EUSART_ASYNCHRONOUS_ADDRESS_DETECT_ENABLE   1
+#define EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE  0
+/* Multi-drop address accepted by every node */
+#define EUSART_BROADCAST_ADDRESS        0xFFU
+
+/* EUSART Synchronous Role (TXSTA.CSRC) */
+#define EUSART_SYNC_MASTER              1
+#define EUSART_SYNC_SLAVE               0
+/* EUSART Synchronous Clock Idle State (BAUDCON.SCKP) */
+#define EUSART_SYNC_CLOCK_IDLE_HIGH     1
+#define EUSART_SYNC_CLOCK_IDLE_LOW      0
+/* EUSART Synchronous Reception */
+#define EUSART_SYNC_SINGLE_RECEIVE      0
+#define EUSART_SYNC_CONTINUOUS_RECEIVE  1
 
 /* EUSART Framing Error */
 #define EUSART_FRAMING_ERROR_DETECTED 1
@@ -58,8 +73,75 @@
 #define EUSART_OVERRUN_ERROR_DETECTED 1
 #define EUSART_OVERRUN_ERROR_CLEARED  0
 
+/* EUSART Auto-Baud Detection Status */
+#define EUSART_AUTO_BAUD_IDLE       0
+#define EUSART_AUTO_BAUD_BUSY       1
+#define EUSART_AUTO_BAUD_DONE       2
+#define EUSART_AUTO_BAUD_OVERFLOW   3
+
+#if EUSART_RX_BUFFER_CONFIGURATION==CONFIG_ENABLE
+#if (EUSART_RX_BUFFER_SIZE < 2U) || (EUSART_RX_BUFFER_SIZE > 128U) || ((EUSART_RX_BUFFER_SIZE & (EUSART_RX_BUFFER_SIZE - 1U)) != 0U)
+#error "EUSART_RX_BUFFER_SIZE must be a power of two between 2 and 128"
+#endif
+/* Index mask of the receive ring buffer */
+#define EUSART_RX_BUFFER_MASK         (EUSART_RX_BUFFER_SIZE - 1U)
+#endif
+
+#if EUSART_TX_QUEUE_CONFIGURATION==CONFIG_ENABLE
+#if (EUSART_TX_QUEUE_SIZE < 2U) || (EUSART_TX_QUEUE_SIZE > 128U) || ((EUSART_TX_QUEUE_SIZE & (EUSART_TX_QUEUE_SIZE - 1U)) != 0U)
+#error "EUSART_TX_QUEUE_SIZE must be a power of two between 2 and 128"
+#endif
+/* Index mask of the transmit queue */
+#define EUSART_TX_QUEUE_MASK          (EUSART_TX_QUEUE_SIZE - 1U)
+#endif
+
 /******************************Macro Function Declarations******************************/
 
+/* 
+ * Compile-time baud rate generator selection, integer only so no float code is pulled in.
+ * The dividers are 64 (8-bit low speed), 16 (8-bit high speed / 16-bit low speed) and 4 (16-bit high speed, synchronous).
+ */
+/* Rounded SPBRGH:SPBRG value of a divider, wraps to a huge value when the rate is out of reach */
+#define EUSART_BRG_VALUE(_baud , _div)          ((((_XTAL_FREQ) + (((_div) * (_baud)) / 2UL)) / ((_div) * (_baud))) - 1UL)
+/* Baud rate actually produced by a BRG value */
+#define EUSART_BRG_ACTUAL(_brg , _div)          ((_XTAL_FREQ) / ((_div) * ((_brg) + 1UL)))
+/* Error of a divider in per-mille, 0xFFFF when the BRG value does not fit the generator width */
+#define EUSART_BRG_ERROR(_baud , _div , _max)   ((EUSART_BRG_VALUE(_baud , _div) > (_max)) ? 0xFFFFUL : \
+                                                 ((EUSART_BRG_ACTUAL(EUSART_BRG_VALUE(_baud , _div) , _div) > (_baud)) ? \
+                                                  (((EUSART_BRG_ACTUAL(EUSART_BRG_VALUE(_baud , _div) , _div) - (_baud)) * 1000UL) / (_baud)) : \
+                                                  ((((_baud) - EUSART_BRG_ACTUAL(EUSART_BRG_VALUE(_baud , _div) , _div)) * 1000UL) / (_baud))))
+
+#define EUSART_BRG_ERROR_8BIT_LOW(_baud)        EUSART_BRG_ERROR(_baud , 64UL , 0xFFUL)
+#define EUSART_BRG_ERROR_8BIT_HIGH(_baud)       EUSART_BRG_ERROR(_baud , 16UL , 0xFFUL)
+#define EUSART_BRG_ERROR_16BIT_LOW(_baud)       EUSART_BRG_ERROR(_baud , 16UL , 0xFFFFUL)
+#define EUSART_BRG_ERROR_16BIT_HIGH(_baud)      EUSART_BRG_ERROR(_baud , 4UL , 0xFFFFUL)
+
+/* Index of the asynchronous mode with the lowest error (0 .. 3 in baudrate_gen_t order), ties keep the 8-bit modes */
+#define EUSART_BRG_BEST_INDEX(_baud)            (((EUSART_BRG_ERROR_8BIT_LOW(_baud) <= EUSART_BRG_ERROR_8BIT_HIGH(_baud)) && \
+                                                  (EUSART_BRG_ERROR_8BIT_LOW(_baud) <= EUSART_BRG_ERROR_16BIT_LOW(_baud)) && \
+                                                  (EUSART_BRG_ERROR_8BIT_LOW(_baud) <= EUSART_BRG_ERROR_16BIT_HIGH(_baud))) ? 0U : \
+                                                 (((EUSART_BRG_ERROR_8BIT_HIGH(_baud) <= EUSART_BRG_ERROR_16BIT_LOW(_baud)) && \
+                                                   (EUSART_BRG_ERROR_8BIT_HIGH(_baud) <= EUSART_BRG_ERROR_16BIT_HIGH(_baud))) ? 1U : \
+                                                  ((EUSART_BRG_ERROR_16BIT_LOW(_baud) <= EUSART_BRG_ERROR_16BIT_HIGH(_baud)) ? 2U : 3U)))
+/* Selected asynchronous mode, to be used for eusart_t.baudrate_config */
+#define EUSART_BRG_BEST_MODE(_baud)             ((baudrate_gen_t)EUSART_BRG_BEST_INDEX(_baud))
+/* Divider of the selected mode */
+#define EUSART_BRG_BEST_DIVIDER(_baud)          ((0U == EUSART_BRG_BEST_INDEX(_baud)) ? 64UL : \
+                                                 ((3U == EUSART_BRG_BEST_INDEX(_baud)) ? 4UL : 16UL))
+/* Error of the selected mode in per-mille, usable in #if */
+#define EUSART_BRG_BEST_ERROR(_baud)            ((0U == EUSART_BRG_BEST_INDEX(_baud)) ? EUSART_BRG_ERROR_8BIT_LOW(_baud) : \
+                                                 ((1U == EUSART_BRG_BEST_INDEX(_baud)) ? EUSART_BRG_ERROR_8BIT_HIGH(_baud) : \
+                                                  ((2U == EUSART_BRG_BEST_INDEX(_baud)) ? EUSART_BRG_ERROR_16BIT_LOW(_baud) : \
+                                                   EUSART_BRG_ERROR_16BIT_HIGH(_baud))))
+/* SPBRGH:SPBRG value of the selected mode, to be used for eusart_t.baudrate_brg_value */
+#define EUSART_BRG_BEST_VALUE(_baud)            ((uint16)EUSART_BRG_VALUE(_baud , EUSART_BRG_BEST_DIVIDER(_baud)))
+/* SPBRGH:SPBRG value of the synchronous master modes */
+#define EUSART_BRG_SYNC_VALUE(_baud)            ((uint16)EUSART_BRG_VALUE(_baud , 4UL))
+
+#if EUSART_BRG_BEST_ERROR(EUSART_ASYNC_BAUDRATE) > EUSART_BAUDRATE_ERROR_TOLERANCE
+#error "EUSART_ASYNC_BAUDRATE cannot be generated from _XTAL_FREQ within EUSART_BAUDRATE_ERROR_TOLERANCE by any BRG mode"
+#endif
+
 /***********************************Datatype Declarations*******************************/
 
 typedef enum{
@@ -84,9 +166,16 @@ typedef struct{
 	uint8 eusart_rx_enable : 1;
 	uint8 eusart_rx_interrupt_enable : 1;
 	uint8 eusart_rx_9bit_enable : 1;
-    uint8 eusart_rx_reserved : 5;
+	uint8 eusart_rx_address_detect_enable : 1;
+    uint8 eusart_rx_reserved : 4;
 }eusart_rx_cfg_t;
 
+typedef struct{
+	uint8 eusart_sync_role : 1;
+	uint8 eusart_sync_clock_idle : 1;
+    uint8 eusart_sync_reserved : 6;
+}eusart_sync_cfg_t;
+
 typedef union{
 	struct{
 		uint8 eusart_tx_reserved : 6;
@@ -97,11 +186,19 @@ typedef union{
 }eusart_error_status_t;
 
 typedef struct{
-    uint32 baudrate;
+    uint16 framing_errors;      /* characters received without a valid stop bit, discarded */
+    uint16 overrun_errors;      /* hardware FIFO overruns, each one restarts the receiver */
+    uint16 rx_restarts;         /* CREN cycles, automatic and through EUSART_ASYNC_RX_Restart() */
+}eusart_error_counters_t;
+
+typedef struct{
+    uint16 baudrate_brg_value;          /* SPBRGH:SPBRG, computed with the EUSART_BRG_* macros */
     baudrate_gen_t baudrate_config;
     eusart_tx_cfg_t eusart_tx_cfg;
 	eusart_rx_cfg_t eusart_rx_cfg;
+    eusart_sync_cfg_t eusart_sync_cfg;
 	eusart_error_status_t error_status;
+    uint8 node_address;                 /* multi-drop address of this node */
 	void (*EUSART_TxInterruptHandler)(void);
     void (*EUSART_RxInterruptHandler)(void);
     void (*EUSART_FramingErrorHandler)(void);
@@ -154,6 +251,65 @@ Std_ReturnType EUSART_ASYNC_Read_Byte_Non_Blocking(const eusart_t *_eusart_obj ,
  *          (E_NOT_OK) : the function has issue to perform this action
  */
 Std_ReturnType EUSART_ASYNC_RX_Restart(const eusart_t *_eusart_obj);
+/**
+ * @brief Get the FERR/OERR status latched by the RX path since the last call, then clear it
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _error_status latched error flags (eusart_ferr / eusart_oerr)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Get_Error_Status(const eusart_t *_eusart_obj , eusart_error_status_t *_error_status);
+/**
+ * @brief Get the receive error counters
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _counters copy of the framing error, overrun and receiver restart counters
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Get_Error_Counters(const eusart_t *_eusart_obj , eusart_error_counters_t *_counters);
+/**
+ * @brief Reset the receive error counters
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Clear_Error_Counters(const eusart_t *_eusart_obj);
+
+#if EUSART_RX_BUFFER_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Get the number of received bytes waiting in the receive ring buffer
+ * @note The ring buffer is filled by EUSART_Rx_ISR, the RX interrupt must be enabled in the configurations
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _available number of bytes ready to be read
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Available(const eusart_t *_eusart_obj , uint8 *_available);
+/**
+ * @brief Reading up to _length bytes from the receive ring buffer without blocking the CPU
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _data pointer to the destination buffer
+ * @param _length maximum number of bytes to be read
+ * @param _read_length number of bytes actually read
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Read_Buffer(const eusart_t *_eusart_obj , uint8 *_data , uint8 _length , uint8 *_read_length);
+/**
+ * @brief Get the number of received bytes dropped because the receive ring buffer was full
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _dropped number of dropped bytes (saturates at 255)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Get_Dropped_Bytes(const eusart_t *_eusart_obj , uint8 *_dropped);
+#endif
 
 
 /**
@@ -193,5 +349,155 @@ Std_ReturnType EUSART_ASYNC_Write_Byte_Non_Blocking(const eusart_t *_eusart_obj
  */
 Std_ReturnType EUSART_ASYNC_Write_String_Non_Blocking(const eusart_t *_eusart_obj , uint8 *_data , uint32 _str_length);
 
+#if EUSART_TX_QUEUE_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Queue a buffer to be sent by the TX interrupt, one byte per TX interrupt
+ * @note The whole buffer is queued or nothing is, the call never blocks the CPU.
+ *       The callback runs from interrupt context once the last byte of the buffer is loaded in TXREG.
+ *       Only one completion callback can be pending at a time.
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _data pointer to the bytes to be sent (copied into the transmit queue)
+ * @param _length number of bytes to be sent
+ * @param _done_callback called when the buffer is handed to the hardware, can be NULL
+ * @return status of the function
+ *          (E_OK) : the buffer is queued
+ *          (E_NOT_OK) : the queue has no room for the buffer or a completion callback is still pending
+ */
+Std_ReturnType EUSART_ASYNC_Write_Buffer_Async(const eusart_t *_eusart_obj , const uint8 *_data , uint8 _length , void (*_done_callback)(void));
+/**
+ * @brief Get the free space in the transmit queue
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _free number of bytes that can be queued
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Tx_Queue_Free(const eusart_t *_eusart_obj , uint8 *_free);
+#endif
+
+#if EUSART_MULTIDROP_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Send a multi-drop address byte (9th bit set), the following data bytes select only that node
+ * @note The transmitter must be configured with eusart_tx_9bit_enable, the transmit queue has to be empty
+ *       and the call waits at most one character time for TXREG to be free
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _address address of the destination node, EUSART_BROADCAST_ADDRESS selects every node
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Write_Address(const eusart_t *_eusart_obj , uint8 _address);
+/**
+ * @brief Ignore the data bytes until the next address byte, ends the current multi-drop message
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Address_Detect_Resume(const eusart_t *_eusart_obj);
+#endif
+
+#if EUSART_AUTO_BAUD_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Arm the auto-baud detection, the next received 0x55 ('U') character sets the baud rate generator
+ * @note The generator is switched to BAUDRATE_ASYN_16BIT_HIGH_SPEED for the best resolution,
+ *       the measurement character is never stored in the receive buffer
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Auto_Baud_Start(const eusart_t *_eusart_obj);
+/**
+ * @brief Get the state of the auto-baud detection
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _status EUSART_AUTO_BAUD_IDLE, EUSART_AUTO_BAUD_BUSY, EUSART_AUTO_BAUD_DONE or EUSART_AUTO_BAUD_OVERFLOW
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Auto_Baud_Status(const eusart_t *_eusart_obj , uint8 *_status);
+/**
+ * @brief Read the baud rate generator value set by the last auto-baud measurement
+ * @note The value is in the BAUDRATE_ASYN_16BIT_HIGH_SPEED mode the measurement runs in
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _brg_value the SPBRGH:SPBRG value
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Auto_Baud_Get_Brg(const eusart_t *_eusart_obj , uint16 *_brg_value);
+/**
+ * @brief Change the baud rate at run time, waits for the character being shifted out to complete
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _baudrate_config one of the asynchronous baudrate_gen_t modes
+ * @param _brg_value SPBRGH:SPBRG value, computed with EUSART_BRG_BEST_VALUE()
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_ASYNC_Set_Baud_Rate(const eusart_t *_eusart_obj , baudrate_gen_t _baudrate_config , uint16 _brg_value);
+#endif
+
+#if EUSART_SYNCHRONOUS_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Initialize EUSART module in synchronous master or slave mode
+ * @note RC6 is the clock (CK) and RC7 the data line (DT), the module starts idle in transmit direction.
+ *       baudrate_config must be BAUDRATE_SYN_8BIT or BAUDRATE_SYN_16BIT, the master loads EUSART_BRG_SYNC_VALUE()
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Init(const eusart_t *_eusart_obj);
+/**
+ * @brief DeInitialize the synchronous EUSART module
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_DeInit(const eusart_t *_eusart_obj);
+/**
+ * @brief Turn the half-duplex data line to transmit, waits for a pending reception to be cancelled
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Transmit_Mode(const eusart_t *_eusart_obj);
+/**
+ * @brief Turn the half-duplex data line to receive
+ * @note Any character still being shifted out is completed first
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _reception EUSART_SYNC_SINGLE_RECEIVE (master only, one byte) or EUSART_SYNC_CONTINUOUS_RECEIVE
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Receive_Mode(const eusart_t *_eusart_obj , uint8 _reception);
+/**
+ * @brief Send a buffer and wait until its last bit is on the line
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _data pointer to the bytes to be sent
+ * @param _length number of bytes to be sent
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Write_Buffer_Blocking(const eusart_t *_eusart_obj , const uint8 *_data , uint8 _length);
+/**
+ * @brief Receive a buffer, the master clocks in exactly _length bytes
+ * @note The slave stays in continuous reception after the call
+ * @param _eusart_obj pointer to the EUSART module configurations
+ * @param _data pointer to the destination buffer
+ * @param _length number of bytes to be received
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType EUSART_SYNC_Read_Buffer_Blocking(const eusart_t *_eusart_obj , uint8 *_data , uint8 _length);
+#endif
+
 #endif	/* HAL_EUSART_H */
 
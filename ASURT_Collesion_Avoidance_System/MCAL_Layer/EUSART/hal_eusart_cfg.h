@@ -12,6 +12,30 @@
 
 /***********************************Macro Declarations**********************************/
 
+/* Asynchronous baud rate, the BRG mode and SPBRGH:SPBRG value are derived from it at compile time */
+#define EUSART_ASYNC_BAUDRATE               9600UL
+/* Largest accepted baud rate error in per-mille of the requested rate (20 = 2.0 %) */
+#define EUSART_BAUDRATE_ERROR_TOLERANCE     20UL
+
+/* Interrupt driven reception : EUSART_Rx_ISR drains RCREG into a software ring buffer */
+#define EUSART_RX_BUFFER_CONFIGURATION  CONFIG_ENABLE
+/* Size of the receive ring buffer in bytes (power of two, from 2 up to 128) */
+#define EUSART_RX_BUFFER_SIZE           32U
+
+/* Interrupt driven transmission : EUSART_Tx_ISR feeds TXREG from a software queue */
+#define EUSART_TX_QUEUE_CONFIGURATION   CONFIG_ENABLE
+/* Size of the transmit queue in bytes (power of two, from 2 up to 128) */
+#define EUSART_TX_QUEUE_SIZE            32U
+
+/* 9-bit multi-drop addressing : RCSTA.ADDEN filtering of address bytes in EUSART_Rx_ISR */
+#define EUSART_MULTIDROP_CONFIGURATION  CONFIG_ENABLE
+
+/* Synchronous (clocked) master / slave mode : EUSART_SYNC_* functions */
+#define EUSART_SYNCHRONOUS_CONFIGURATION    CONFIG_ENABLE
+
+/* Auto-baud detection (BAUDCON.ABDEN) and run time baud rate switching */
+#define EUSART_AUTO_BAUD_CONFIGURATION  CONFIG_ENABLE
+
 /******************************Macro Function Declarations******************************/
 
 /***********************************Datatype Declarations*******************************/
@@ -11,14 +11,11 @@ static void (*INT0_InterruptHandler)(void) = NULL;
 static void (*INT1_InterruptHandler)(void) = NULL;
 static void (*INT2_InterruptHandler)(void) = NULL;
 
-static void (*RB4_InterruptHandler_HIGH)(void) = NULL;
-static void (*RB4_InterruptHandler_LOW)(void) = NULL;
-static void (*RB5_InterruptHandler_HIGH)(void) = NULL;
-static void (*RB5_InterruptHandler_LOW)(void) = NULL;
-static void (*RB6_InterruptHandler_HIGH)(void) = NULL;
-static void (*RB6_InterruptHandler_LOW)(void) = NULL;
-static void (*RB7_InterruptHandler_HIGH)(void) = NULL;
-static void (*RB7_InterruptHandler_LOW)(void) = NULL;
+/* RB4..RB7 rising (HIGH) and falling (LOW) edge callbacks , indexed by (pin - GPIO_PIN4) */
+static void (*RBx_InterruptHandler_HIGH[EXT_RBx_PINS_COUNT])(void) = {NULL};
+static void (*RBx_InterruptHandler_LOW[EXT_RBx_PINS_COUNT])(void) = {NULL};
+/* Last PORTB snapshot seen by the RBx ISR , only the RB4..RB7 bits are meaningful */
+static uint8 RBx_previous_state = 0;
 
 /*------------------------------------------------------------------------------------------------------*/
 
@@ -29,9 +26,9 @@ static Std_ReturnType Interrupt_INTx_Edge_Init(const interrupt_INTx_t *int_obj);
 static Std_ReturnType Interrupt_INTx_Pin_Init(const interrupt_INTx_t *int_obj);
 static Std_ReturnType Interrupt_INTx_Clear_Flag(const interrupt_INTx_t *int_obj);
 
-static Std_ReturnType INT0_SetInterruptHandler(void(*InterruptHandler(void)));
-static Std_ReturnType INT1_SetInterruptHandler(void(*InterruptHandler(void)));
-static Std_ReturnType INT2_SetInterruptHandler(void(*InterruptHandler(void)));
+static Std_ReturnType INT0_SetInterruptHandler(void(*InterruptHandler)(void));
+static Std_ReturnType INT1_SetInterruptHandler(void(*InterruptHandler)(void));
+static Std_ReturnType INT2_SetInterruptHandler(void(*InterruptHandler)(void));
 static Std_ReturnType Interrupt_INTx_SetInterruptHandler(const interrupt_INTx_t *int_obj);
 
 static Std_ReturnType Interrupt_RBx_Enable(const interrupt_RBx_t *int_obj);
@@ -72,68 +69,38 @@ void INT2_ISR(void){
     }
 }
 
-void RB4_ISR(uint8 RB4_Source){
-    /* The RB4 external interrupt occurred (must be cleared in software) */
+void RBx_ISR(void){
+    uint8 l_portb_state = 0;
+    uint8 l_changed_pins = 0;
+    uint8 l_pin_index = 0;
+    /* Single PORTB read : ends the mismatch condition and gives one consistent snapshot of RB4..RB7 */
+    l_portb_state = PORTB;
+    /* The RBx external interrupt occurred (must be cleared in software) */
     EXT_RBx_InterruptFlagClear();
-    /* Code : to be executed from MCAL interrupt context */
-    /* Application callback function gets called every time this ISR executes*/
-    if(0 == RB4_Source){
-        if(RB4_InterruptHandler_HIGH){
-            RB4_InterruptHandler_HIGH();
-        }
-    }
-    else if(1 == RB4_Source){
-        if(RB4_InterruptHandler_LOW){
-            RB4_InterruptHandler_LOW();
-        }
-    }
-}
-void RB5_ISR(uint8 RB5_Source){
-    /* The RB5 external interrupt occurred (must be cleared in software) */
-    EXT_RBx_InterruptFlagClear();
-    /* Code : to be executed from MCAL interrupt context */
-    /* Application callback function gets called every time this ISR executes*/
-    if(0 == RB5_Source){
-        if(RB5_InterruptHandler_HIGH){
-            RB5_InterruptHandler_HIGH();
-        }
-    }
-    else if(1 == RB5_Source){
-        if(RB5_InterruptHandler_LOW){
-            RB5_InterruptHandler_LOW();
-        }
-    }
-}
-void RB6_ISR(uint8 RB6_Source){
-    /* The RB6 external interrupt occurred (must be cleared in software) */
-    EXT_RBx_InterruptFlagClear();
-    /* Code : to be executed from MCAL interrupt context */
-    /* Application callback function gets called every time this ISR executes*/
-    if(0 == RB6_Source){
-        if(RB6_InterruptHandler_HIGH){
-            RB6_InterruptHandler_HIGH();
-        }
-    }
-    else if(1 == RB6_Source){
-        if(RB6_InterruptHandler_LOW){
-            RB6_InterruptHandler_LOW();
-        }
-    }
-}
-void RB7_ISR(uint8 RB7_Source){
-    /* The RB7 external interrupt occurred (must be cleared in software) */
-    EXT_RBx_InterruptFlagClear();
-    /* Code : to be executed from MCAL interrupt context */
-    /* Application callback function gets called every time this ISR executes*/
-    if(0 == RB7_Source){
-        if(RB7_InterruptHandler_HIGH){
-            RB7_InterruptHandler_HIGH();
-        }
-    }
-    else if(1 == RB7_Source){
-        if(RB7_InterruptHandler_LOW){
-            RB7_InterruptHandler_LOW();
+    /* Every pin that changed since the last snapshot is dispatched in this pass */
+    l_changed_pins = (uint8)((l_portb_state ^ RBx_previous_state) & EXT_RBx_PINS_MASK);
+    RBx_previous_state = l_portb_state;
+    l_changed_pins >>= GPIO_PIN4;
+    l_portb_state >>= GPIO_PIN4;
+    /* Application callback function gets called for each edge with its direction */
+    for(l_pin_index = 0 ; 0 != l_changed_pins ; l_pin_index++){
+        if(l_changed_pins & 0x01U){
+            if(l_portb_state & 0x01U){
+                if(RBx_InterruptHandler_HIGH[l_pin_index]){
+                    RBx_InterruptHandler_HIGH[l_pin_index]();
+                }
+                else{ /* Nothing */ }
+            }
+            else{
+                if(RBx_InterruptHandler_LOW[l_pin_index]){
+                    RBx_InterruptHandler_LOW[l_pin_index]();
+                }
+                else{ /* Nothing */ }
+            }
         }
+        else{ /* Nothing */ }
+        l_changed_pins >>= 1;
+        l_portb_state >>= 1;
     }
 }
 
@@ -213,26 +180,16 @@ Std_ReturnType Interrupt_RBx_Init(const interrupt_RBx_t *int_obj){
         /* Configure external interrupt I/O pin */
         retVal = Interrupt_RBx_Pin_Init(int_obj);
         /* Configure default interrupt callback */
-        switch(int_obj->mcu_pin.pin){
-            case GPIO_PIN4 : 
-                RB4_InterruptHandler_HIGH = int_obj->EXT_InterruptHandler_HIGH;
-                RB4_InterruptHandler_LOW = int_obj->EXT_InterruptHandler_LOW;
-                break;
-            case GPIO_PIN5 : 
-                RB5_InterruptHandler_HIGH = int_obj->EXT_InterruptHandler_HIGH;
-                RB5_InterruptHandler_LOW = int_obj->EXT_InterruptHandler_LOW;
-                break;
-            case GPIO_PIN6 : 
-                RB6_InterruptHandler_HIGH = int_obj->EXT_InterruptHandler_HIGH;
-                RB6_InterruptHandler_LOW = int_obj->EXT_InterruptHandler_LOW;
-                break;
-            case GPIO_PIN7 : 
-                RB7_InterruptHandler_HIGH = int_obj->EXT_InterruptHandler_HIGH;
-                RB7_InterruptHandler_LOW = int_obj->EXT_InterruptHandler_LOW;
-                break;
-            default : 
-                retVal = E_NOT_OK;
+        if((GPIO_PIN4 <= int_obj->mcu_pin.pin) && (GPIO_PIN7 >= int_obj->mcu_pin.pin)){
+            RBx_InterruptHandler_HIGH[int_obj->mcu_pin.pin - GPIO_PIN4] = int_obj->EXT_InterruptHandler_HIGH;
+            RBx_InterruptHandler_LOW[int_obj->mcu_pin.pin - GPIO_PIN4] = int_obj->EXT_InterruptHandler_LOW;
         }
+        else{
+            retVal = E_NOT_OK;
+        }
+        /* Take the reference snapshot the next change is compared against */
+        RBx_previous_state = PORTB;
+        EXT_RBx_InterruptFlagClear();
         /* Enable the external interrupt */
         retVal = Interrupt_RBx_Enable(int_obj);
     }
@@ -445,7 +402,7 @@ static Std_ReturnType Interrupt_INTx_Clear_Flag(const interrupt_INTx_t *int_obj)
 
 /*------------------------------------------------------------------------------------------------------*/
 
-static Std_ReturnType INT0_SetInterruptHandler(void(*InterruptHandler(void))){
+static Std_ReturnType INT0_SetInterruptHandler(void(*InterruptHandler)(void)){
     Std_ReturnType retVal = E_NOT_OK;
     if(NULL == InterruptHandler){
         retVal = E_NOT_OK;
@@ -456,7 +413,7 @@ static Std_ReturnType INT0_SetInterruptHandler(void(*InterruptHandler(void))){
     }
     return retVal;
 }
-static Std_ReturnType INT1_SetInterruptHandler(void(*InterruptHandler(void))){
+static Std_ReturnType INT1_SetInterruptHandler(void(*InterruptHandler)(void)){
     Std_ReturnType retVal = E_NOT_OK;
     if(NULL == InterruptHandler){
         retVal = E_NOT_OK;
@@ -467,7 +424,7 @@ static Std_ReturnType INT1_SetInterruptHandler(void(*InterruptHandler(void))){
     }
     return retVal;
 }
-static Std_ReturnType INT2_SetInterruptHandler(void(*InterruptHandler(void))){
+static Std_ReturnType INT2_SetInterruptHandler(void(*InterruptHandler)(void)){
     Std_ReturnType retVal = E_NOT_OK;
     if(NULL == InterruptHandler){
         retVal = E_NOT_OK;
@@ -534,9 +491,11 @@ static Std_ReturnType Interrupt_RBx_Priority_Init(const interrupt_RBx_t *int_obj
                 INTERRUPT_PriorityLevelEnable();
                 if(INTERRUPT_LOW_PRIORITY == int_obj->priority){
                     INTERRUPT_GlobalInterruptLowEnable();   
+                    EXT_RBx_LowPrioritySet();
                 }
                 else if(INTERRUPT_HIGH_PRIORITY == int_obj->priority){
                     INTERRUPT_GlobalInterruptHighEnable();
+                    EXT_RBx_HighPrioritySet();
                 }
 #else
                 INTERRUPT_GlobalInterruptEnable();
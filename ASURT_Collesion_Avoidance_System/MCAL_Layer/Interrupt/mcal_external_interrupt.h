@@ -70,6 +70,9 @@
 #define EXT_RBx_InterruptDisable() (INTCONbits.RBIE = 0)
 /* This routine clears the interrupt flag for the external interrupt , RBx*/
 #define EXT_RBx_InterruptFlagClear() (INTCONbits.RBIF = 0)
+/* RB4..RB7 are the only PORTB pins with interrupt on change */
+#define EXT_RBx_PINS_MASK 0xF0U
+#define EXT_RBx_PINS_COUNT 4U
 
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
 /* This routine sets high priority of the external interrupt , RBx */
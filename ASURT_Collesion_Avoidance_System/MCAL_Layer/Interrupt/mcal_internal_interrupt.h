@@ -36,13 +36,28 @@
 #define TIMER0_InterruptDisable() (INTCONbits.TMR0IE = 0)
 /* This routine sets the interrupt enable for the Timer0 module */
 #define TIMER0_InterruptEnable() (INTCONbits.TMR0IE = 1)
-/* This routine clears the interrupt flag for the Timer2 module */
+/* This routine clears the interrupt flag for the Timer0 module */
 #define TIMER0_InterruptFlagClear() (INTCONbits.TMR0IF = 0)
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
 /* This routine sets high priority of the Timer0 module */
-#define TIMER0_HighPrioritySet() (IPR1bits.TMR0IP = 1)
+#define TIMER0_HighPrioritySet() (INTCON2bits.TMR0IP = 1)
 /* This routine sets low priority of the Timer0 module */
-#define TIMER0_LowPrioritySet() (IPR1bits.TMR0IP = 0)
+#define TIMER0_LowPrioritySet() (INTCON2bits.TMR0IP = 0)
+#endif
+#endif
+
+#if TIMER1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+/* This routine clears the interrupt enable for the Timer1 module */
+#define TIMER1_InterruptDisable() (PIE1bits.TMR1IE = 0)
+/* This routine sets the interrupt enable for the Timer1 module */
+#define TIMER1_InterruptEnable() (PIE1bits.TMR1IE = 1)
+/* This routine clears the interrupt flag for the Timer1 module */
+#define TIMER1_InterruptFlagClear() (PIR1bits.TMR1IF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+/* This routine sets high priority of the Timer1 module */
+#define TIMER1_HighPrioritySet() (IPR1bits.TMR1IP = 1)
+/* This routine sets low priority of the Timer1 module */
+#define TIMER1_LowPrioritySet() (IPR1bits.TMR1IP = 0)
 #endif
 #endif
 
@@ -61,6 +76,21 @@
 #endif
 #endif
 
+#if TIMER3_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+/* This routine clears the interrupt enable for the Timer3 module */
+#define TIMER3_InterruptDisable() (PIE2bits.TMR3IE = 0)
+/* This routine sets the interrupt enable for the Timer3 module */
+#define TIMER3_InterruptEnable() (PIE2bits.TMR3IE = 1)
+/* This routine clears the interrupt flag for the Timer3 module */
+#define TIMER3_InterruptFlagClear() (PIR2bits.TMR3IF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+/* This routine sets high priority of the Timer3 module */
+#define TIMER3_HighPrioritySet() (IPR2bits.TMR3IP = 1)
+/* This routine sets low priority of the Timer3 module */
+#define TIMER3_LowPrioritySet() (IPR2bits.TMR3IP = 0)
+#endif
+#endif
+
 
 #if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
 /* This routine clears the interrupt enable for the CCP1 module */
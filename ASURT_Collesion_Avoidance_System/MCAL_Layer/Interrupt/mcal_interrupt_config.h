@@ -36,8 +36,8 @@
 /*This macro will disable global high priority interrupts*/
 #define INTERRUPT_GlobalInterruptHighDisable() (INTCONbits.GIEH = 0)
 
-/*This macro will enable global low priority interrupts*/
-#define INTERRUPT_GlobalInterruptLowEnable() (INTCONbits.GIEL = 1)
+/*This macro will enable global low priority interrupts, GIEH = 0 masks the low priority level as well*/
+#define INTERRUPT_GlobalInterruptLowEnable() (INTCONbits.GIEH = 1 , INTCONbits.GIEL = 1)
 /*This macro will disable global low priority interrupts*/
 #define INTERRUPT_GlobalInterruptLowDisable() (INTCONbits.GIEL = 0)
 #else
@@ -14,7 +14,7 @@
 
 #define INTERRUPT_FEATURE_ENABLE 1U
 
-//#define INTERRUPT_PRIORITY_LEVELS_ENABLE                INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_PRIORITY_LEVELS_ENABLE                INTERRUPT_FEATURE_ENABLE
 
 #define EXTERNAL_INTERRUPT_INTx_FEATRUE_ENABLE          INTERRUPT_FEATURE_ENABLE
 #define EXTERNAL_INTERRUPT_ON_CHANGE_FEATRUE_ENABLE     INTERRUPT_FEATURE_ENABLE
@@ -35,6 +35,47 @@
 #define MSSP_SPI_INTERRUPT_FEATURE_ENABLE               INTERRUPT_FEATURE_ENABLE
 #define MSSP_I2C_INTERRUPT_FEATURE_ENABLE               INTERRUPT_FEATURE_ENABLE
 
+/*
+ * SENSOR_NODE_BUILD is defined by the sensor_node build configuration only, the default configuration
+ * builds the receiver. Both images share the MCAL layer and differ in the tables below.
+ */
+
+/*
+ * Interrupt dispatch tables : the sources polled by each vector, in the order they are checked.
+ * Only the sources used on this board are listed, a source missing from both tables is never polled.
+ * A source must be listed in the table matching the priority set in its driver configurations,
+ * when priority levels are disabled both tables are polled by the single vector (high table first).
+ * Available sources : TIMER0, TIMER1, TIMER2, TIMER3, EUSART_RX, EUSART_TX, CCP1, CCP2, ADC, INT0, INT1, INT2, RBx
+ */
+#define INTERRUPT_HIGH_PRIORITY_DISPATCH_TABLE(SOURCE)  \
+    SOURCE(TIMER0)
+
+#ifdef SENSOR_NODE_BUILD
+/* Sensor node (PIC 2) : analog or ultrasonic ranging and link , no buzzer tone */
+#define INTERRUPT_LOW_PRIORITY_DISPATCH_TABLE(SOURCE)   \
+    SOURCE(CCP2)                                        \
+    SOURCE(TIMER3)                                      \
+    SOURCE(ADC)                                         \
+    SOURCE(EUSART_RX)                                   \
+    SOURCE(EUSART_TX)                                   \
+    SOURCE(TIMER1)
+#else
+/* Receiver (PIC 1) */
+#define INTERRUPT_LOW_PRIORITY_DISPATCH_TABLE(SOURCE)   \
+    SOURCE(EUSART_RX)                                   \
+    SOURCE(EUSART_TX)                                   \
+    SOURCE(CCP1)                                        \
+    SOURCE(TIMER1)                                      \
+    SOURCE(TIMER2)
+#endif
+
+/*
+ * Compile-time handler binding : when a source handler is defined here the driver ISR calls it
+ * directly instead of the handler pointer passed in its configurations.
+ * Available bindings : TIMER0, TIMER1, TIMER2, TIMER3, EUSART_TX, EUSART_RX, CCP1, CCP2, ADC (xxx_INTERRUPT_HANDLER)
+ */
+#define TIMER0_INTERRUPT_HANDLER                        Timer0_DefaultInterruptHandler
+
 /******************************Macro Function Declarations******************************/
 
 /***********************************Datatype Declarations*******************************/
@@ -7,111 +7,105 @@
 
 #include "mcal_interrupt_manager.h"
 
-static volatile uint8 RB4_flag = 1 , RB5_flag = 1 , RB6_flag = 1 , RB7_flag = 1;
+/*
+ * Per-source dispatch checks used to expand the dispatch tables of mcal_interrupt_gen_cfg.h ,
+ * a source whose interrupt feature is disabled expands to nothing.
+ * A source is only serviced by the vector its IP bit routes it to (INT0 has none , it is always high).
+ */
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_PRIORITY_MATCH(_ip , _level)  ((_level) == (_ip))
+#else
+#define INTERRUPT_PRIORITY_MATCH(_ip , _level)  (1)
+#endif
+
+#if TIMER0_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_TIMER0(_level)  if((INTERRUPT_ENABLE == INTCONbits.TMR0IE) && (INTERRUPT_OCCUR == INTCONbits.TMR0IF) && INTERRUPT_PRIORITY_MATCH(INTCON2bits.TMR0IP , _level)){ TMR0_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_TIMER0(_level)
+#endif
+
+#if TIMER1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_TIMER1(_level)  if((INTERRUPT_ENABLE == PIE1bits.TMR1IE) && (INTERRUPT_OCCUR == PIR1bits.TMR1IF) && INTERRUPT_PRIORITY_MATCH(IPR1bits.TMR1IP , _level)){ TMR1_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_TIMER1(_level)
+#endif
+
+#if TIMER2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_TIMER2(_level)  if((INTERRUPT_ENABLE == PIE1bits.TMR2IE) && (INTERRUPT_OCCUR == PIR1bits.TMR2IF) && INTERRUPT_PRIORITY_MATCH(IPR1bits.TMR2IP , _level)){ TMR2_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_TIMER2(_level)
+#endif
+
+#if TIMER3_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_TIMER3(_level)  if((INTERRUPT_ENABLE == PIE2bits.TMR3IE) && (INTERRUPT_OCCUR == PIR2bits.TMR3IF) && INTERRUPT_PRIORITY_MATCH(IPR2bits.TMR3IP , _level)){ TMR3_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_TIMER3(_level)
+#endif
+
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_EUSART_RX(_level)  if((INTERRUPT_ENABLE == PIE1bits.RCIE) && (INTERRUPT_OCCUR == PIR1bits.RCIF) && INTERRUPT_PRIORITY_MATCH(IPR1bits.RCIP , _level)){ EUSART_Rx_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_EUSART_RX(_level)
+#endif
+
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_EUSART_TX(_level)  if((INTERRUPT_ENABLE == PIE1bits.TXIE) && (INTERRUPT_OCCUR == PIR1bits.TXIF) && INTERRUPT_PRIORITY_MATCH(IPR1bits.TXIP , _level)){ EUSART_Tx_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_EUSART_TX(_level)
+#endif
+
+#if CCP1_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_CCP1(_level)  if((INTERRUPT_ENABLE == PIE1bits.CCP1IE) && (INTERRUPT_OCCUR == PIR1bits.CCP1IF) && INTERRUPT_PRIORITY_MATCH(IPR1bits.CCP1IP , _level)){ CCP1_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_CCP1(_level)
+#endif
+
+#if CCP2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_CCP2(_level)  if((INTERRUPT_ENABLE == PIE2bits.CCP2IE) && (INTERRUPT_OCCUR == PIR2bits.CCP2IF) && INTERRUPT_PRIORITY_MATCH(IPR2bits.CCP2IP , _level)){ CCP2_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_CCP2(_level)
+#endif
+
+#if ADC_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_ADC(_level)  if((INTERRUPT_ENABLE == PIE1bits.ADIE) && (INTERRUPT_OCCUR == PIR1bits.ADIF) && INTERRUPT_PRIORITY_MATCH(IPR1bits.ADIP , _level)){ ADC_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_ADC(_level)
+#endif
+
+#if EXTERNAL_INTERRUPT_INTx_FEATRUE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_INT0(_level)  if((INTERRUPT_ENABLE == INTCONbits.INT0IE) && (INTERRUPT_OCCUR == INTCONbits.INT0IF) && INTERRUPT_PRIORITY_MATCH(INTERRUPT_HIGH_PRIORITY , _level)){ INT0_ISR(); }
+#define INTERRUPT_DISPATCH_INT1(_level)  if((INTERRUPT_ENABLE == INTCON3bits.INT1IE) && (INTERRUPT_OCCUR == INTCON3bits.INT1IF) && INTERRUPT_PRIORITY_MATCH(INTCON3bits.INT1IP , _level)){ INT1_ISR(); }
+#define INTERRUPT_DISPATCH_INT2(_level)  if((INTERRUPT_ENABLE == INTCON3bits.INT2IE) && (INTERRUPT_OCCUR == INTCON3bits.INT2IF) && INTERRUPT_PRIORITY_MATCH(INTCON3bits.INT2IP , _level)){ INT2_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_INT0(_level)
+#define INTERRUPT_DISPATCH_INT1(_level)
+#define INTERRUPT_DISPATCH_INT2(_level)
+#endif
+
+#if EXTERNAL_INTERRUPT_ON_CHANGE_FEATRUE_ENABLE==INTERRUPT_FEATURE_ENABLE
+#define INTERRUPT_DISPATCH_RBx(_level)  if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && INTERRUPT_PRIORITY_MATCH(INTCON2bits.RBIP , _level)){ RBx_ISR(); }
+#else
+#define INTERRUPT_DISPATCH_RBx(_level)
+#endif
+
+#define INTERRUPT_DISPATCH_HIGH(_source)    INTERRUPT_DISPATCH_##_source(INTERRUPT_HIGH_PRIORITY)
+#define INTERRUPT_DISPATCH_LOW(_source)     INTERRUPT_DISPATCH_##_source(INTERRUPT_LOW_PRIORITY)
 
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
 
 void __interrupt() InterruptManagerHigh(void){
-    
+    INTERRUPT_HIGH_PRIORITY_DISPATCH_TABLE(INTERRUPT_DISPATCH_HIGH)
 }
 
 void __interrupt(low_priority) InterruptManagerLow(void){
-    
+    INTERRUPT_LOW_PRIORITY_DISPATCH_TABLE(INTERRUPT_DISPATCH_LOW)
 }
 
 #else
 
 void __interrupt() InterruptManagerHigh(void){
-    /* -------------------------------- INTx External Interrupt Start --------------------------------*/
-    if((INTERRUPT_ENABLE == INTCONbits.INT0IE) && (INTERRUPT_OCCUR == INTCONbits.INT0IF)){
-        INT0_ISR();
-    }
-    if((INTERRUPT_ENABLE == INTCON3bits.INT1IE) && (INTERRUPT_OCCUR == INTCON3bits.INT1IF)){
-        INT1_ISR();
-    }
-    if((INTERRUPT_ENABLE == INTCON3bits.INT2IE) && (INTERRUPT_OCCUR == INTCON3bits.INT2IF)){
-        INT2_ISR();
-    }
-    /* --------------------------------- INTx External Interrupt End ---------------------------------*/
-    
-    /* ------------------------- PORTB External On Change Interrupt Start ----------------------------*/
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) 
-            && (PORTBbits.RB4 == GPIO_HIGH) && (RB4_flag == 1)){
-        RB4_flag = 0;
-        RB4_ISR(0);
-    }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) 
-            && (PORTBbits.RB4 == GPIO_LOW) && (RB4_flag == 0)){
-        RB4_flag = 1;
-        RB4_ISR(1);
-    }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) 
-            && (PORTBbits.RB5 == GPIO_HIGH) && (RB5_flag == 1)){
-        RB5_flag = 0; 
-        RB5_ISR(0);
-    }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) 
-            && (PORTBbits.RB5 == GPIO_LOW)&& (RB5_flag == 0)){
-        RB5_flag = 1; 
-        RB5_ISR(1);
-    }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) 
-            && (PORTBbits.RB6 == GPIO_HIGH) && (RB6_flag == 1)){
-        RB6_flag = 0;
-        RB6_ISR(0);
-    }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) 
-            && (PORTBbits.RB6 == GPIO_LOW) && (RB6_flag == 0)){
-        RB6_flag = 1;
-        RB6_ISR(1);
-    }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) 
-            && (PORTBbits.RB7 == GPIO_HIGH) && (RB7_flag == 1)){
-        RB7_flag = 0;
-        RB7_ISR(0);
-    }
-    if((INTERRUPT_ENABLE == INTCONbits.RBIE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) 
-            && (PORTBbits.RB7 == GPIO_LOW) && (RB7_flag == 0)){
-        RB7_flag = 1;
-        RB7_ISR(1);
-    }
-    /* ----------------------- PORTB External On Change Interrupt End --------------------------*/
-    
-    /* -------------------------- ADC Module Interrupt Start -----------------------------------*/
-    if((INTERRUPT_ENABLE == PIE1bits.ADIE) && (INTERRUPT_OCCUR == PIR1bits.ADIF)){
-        ADC_ISR();
-    }
-    /* --------------------------- ADC Module Interrupt End -------------------------------------*/
-    
-    
-    
-    /* -------------------------- CCP Module Interrupt Start -----------------------------------*/
-    if((INTERRUPT_ENABLE == PIE1bits.CCP1IE) && (INTERRUPT_OCCUR == PIR1bits.CCP1IF)){
-        CCP1_ISR();
-    }
-    
-    if((INTERRUPT_ENABLE == PIE2bits.CCP2IE) && (INTERRUPT_OCCUR == PIR2bits.CCP2IF)){
-        CCP2_ISR();
-    }
-    /* --------------------------- CCP Module Interrupt End -------------------------------------*/
-    
-    /* -------------------------- EUSART Module Interrupt Start -----------------------------------*/
-    if((INTERRUPT_ENABLE == PIE1bits.TXIE) && (INTERRUPT_OCCUR == PIR1bits.TXIF)){
-        EUSART_Tx_ISR();
-    }
-    
-    if((INTERRUPT_ENABLE == PIE1bits.RCIE) && (INTERRUPT_OCCUR == PIR1bits.RCIF)){
-        EUSART_Rx_ISR();
-    }
-    /* --------------------------- EUSART Module Interrupt End -------------------------------------*/
-
-    if((INTERRUPT_ENABLE == INTCONbits.TMR0IE) && (INTERRUPT_OCCUR == INTCONbits.TMR0IF)){
-        TMR0_ISR();
-    }
-    if((INTERRUPT_ENABLE == PIE1bits.TMR2IE) && (INTERRUPT_OCCUR == PIR1bits.TMR2IF)){
-        TMR2_ISR();
-    }
-    
+    INTERRUPT_HIGH_PRIORITY_DISPATCH_TABLE(INTERRUPT_DISPATCH_HIGH)
+    INTERRUPT_LOW_PRIORITY_DISPATCH_TABLE(INTERRUPT_DISPATCH_LOW)
 }
 
-#endif
\ No newline at end of file
+#endif
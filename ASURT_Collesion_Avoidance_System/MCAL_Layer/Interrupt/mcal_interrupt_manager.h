@@ -20,15 +20,14 @@
 void INT0_ISR(void);
 void INT1_ISR(void);
 void INT2_ISR(void);
-void RB4_ISR(uint8 RB4_Source);
-void RB5_ISR(uint8 RB5_Source);
-void RB6_ISR(uint8 RB6_Source);
-void RB7_ISR(uint8 RB7_Source);
+void RBx_ISR(void);
 void ADC_ISR(void);
 void CCP1_ISR(void);
 void CCP2_ISR(void);
 void TMR0_ISR(void);
+void TMR1_ISR(void);
 void TMR2_ISR(void);
+void TMR3_ISR(void);
 void EUSART_Tx_ISR(void);
 void EUSART_Rx_ISR(void);
 
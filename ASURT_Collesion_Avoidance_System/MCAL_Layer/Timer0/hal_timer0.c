@@ -9,9 +9,16 @@
 
 #if TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
 static void (* TMR0_InterruptHandler)(void) = NULL;
+#ifdef TIMER0_INTERRUPT_HANDLER
+void TIMER0_INTERRUPT_HANDLER(void);
+#endif
 #endif
 
 static uint16 Timer0_preload = 0;
+#if TIMER0_DRIFT_FREE_RELOAD_CONFIGURATION==CONFIG_ENABLE
+/* Set when the configured mode allows adding the preload to the running count */
+static uint8 Timer0_accumulate_reload = 0;
+#endif
 
 static inline void timer0_prescaler_cfg(const timer0_t *timer);
 static inline void timer0_mode_select(const timer0_t *timer);
@@ -36,19 +43,28 @@ Std_ReturnType timer0_initialize(const timer0_t *timer){
         TMR0H = (uint8)((timer->preload_value) >> 8);
         TMR0L = (uint8)(timer->preload_value);
         Timer0_preload = timer->preload_value;
+#if TIMER0_DRIFT_FREE_RELOAD_CONFIGURATION==CONFIG_ENABLE
+        if((TIMER0_TIMER_MODE == timer->operation_mode) && (TIMER0_16BIT_REGISTER_MODE == timer->register_size)
+                && (TIMER0_PRESCALER_DISABLE_CFG == timer->prescaler_enable)){
+            Timer0_accumulate_reload = 1;
+        }
+        else{
+            Timer0_accumulate_reload = 0;
+        }
+#endif
 #if TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
         TIMER0_InterruptEnable();
         TIMER0_InterruptFlagClear();
         TMR0_InterruptHandler = timer->TMR0_InterruptHandler;
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityLevelsEnable();
-        if(timer->priority == INTERRUPT_PRIORITY_HIGH){
-            INTERRUPT_GlobalInterruptEnableHigh();
-            Timer0_SetHighPriority();
+        INTERRUPT_PriorityLevelEnable();
+        if(timer->priority == INTERRUPT_HIGH_PRIORITY){
+            INTERRUPT_GlobalInterruptHighEnable();
+            TIMER0_HighPrioritySet();
         }
-        else if(timer->priority == INTERRUPT_PRIORITY_LOW){
-            INTERRUPT_GlobalInterruptEnableLow();
-            Timer0_SetlowPriority();
+        else if(timer->priority == INTERRUPT_LOW_PRIORITY){
+            INTERRUPT_GlobalInterruptLowEnable();
+            TIMER0_LowPrioritySet();
         }
 #else
         INTERRUPT_GlobalInterruptEnable();
@@ -75,7 +91,7 @@ Std_ReturnType timer0_deinitialize(const timer0_t *timer){
     else{
         TIMER0_MODULE_DISABLE();
 #if TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-        Timer0_Interrupt_Disable();
+        TIMER0_InterruptDisable();
 #endif
         ret = E_OK;
     }
@@ -95,15 +111,15 @@ Std_ReturnType timer0_write_value(const timer0_t *timer, uint16 value){
         ret = E_NOT_OK;
     }
     else{
-        TMR0H = (uint8)((timer->preload_value) >> 8);
-        TMR0L = (uint8)(timer->preload_value);
+        TMR0H = (uint8)(value >> 8);
+        TMR0L = (uint8)(value);
         ret = E_OK;
     }
     return ret;
 }
 
 /**
- * @brief Write value in the timer0 register
+ * @brief Read value from the timer0 register
  * @param timer (Pointer to the timer configuration)
  * @param value (Pointer to the value read from the timer register)
  * @return State of the function
@@ -116,21 +132,106 @@ Std_ReturnType timer0_read_value(const timer0_t *timer, uint16 *value){
     }
     else{
         uint8 l_tmr0h = 0, l_tmr0l = 0;
-        l_tmr0h = TMR0H;
+        /* TMR0H is a buffer latched when TMR0L is read, TMR0L must be read first */
         l_tmr0l = TMR0L;
+        l_tmr0h = TMR0H;
         *value = (uint16)((l_tmr0h << 8) + l_tmr0l);
         ret = E_OK;
     }
     return ret;
 }
 
+/**
+ * @brief Change the Timer0 overflow period at runtime, the smallest prescaler fitting the period
+ *        is selected for the best resolution and the timer restarts from the new preload
+ * @param timer (Pointer to the timer configuration, timer mode only)
+ * @param period_us (The overflow period in microseconds, TIMER0_PERIOD_MAX_US at most in 16-bit mode)
+ * @return State of the function
+ */
+Std_ReturnType timer0_set_period_us(const timer0_t *timer, uint32 period_us){
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_cycles = 0;
+    uint32 l_max_counts = 0;
+    uint8 l_shift = 0;
+    uint16 l_preload = 0;
+#if TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    uint8 l_interrupt = 0;
+#endif
+    
+    if((timer == NULL) || (timer->operation_mode != TIMER0_TIMER_MODE) || (0 == period_us) 
+            || (TIMER0_PERIOD_MAX_US < period_us)){
+        ret = E_NOT_OK;
+    }
+    else{
+        l_cycles = TIMER0_PERIOD_CYCLES(period_us);
+        l_max_counts = (timer->register_size == TIMER0_16BIT_REGISTER_MODE) ? 65536UL : 256UL;
+        /* Prescaler 2^l_shift , l_shift = 0 leaves the prescaler disabled */
+        while((l_shift < 8U) && (l_cycles > (l_max_counts << l_shift))){
+            l_shift++;
+        }
+        if(l_cycles > (l_max_counts << l_shift)){
+            ret = E_NOT_OK;
+        }
+        else{
+            l_preload = (uint16)(l_max_counts - ((l_cycles + ((1UL << l_shift) >> 1)) >> l_shift));
+#if TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+            /* The preload is read by the ISR, keep the 16-bit update atomic */
+            l_interrupt = INTCONbits.TMR0IE;
+            TIMER0_InterruptDisable();
+#endif
+            TIMER0_MODULE_DISABLE();
+            if(0 == l_shift){
+                TIMER0_PRESCALER_DISABLE();
+            }
+            else{
+                TIMER0_PRESCALER_ENABLE();
+                T0CONbits.T0PS = (uint8)(l_shift - 1U);
+            }
+            Timer0_preload = l_preload;
+#if TIMER0_DRIFT_FREE_RELOAD_CONFIGURATION==CONFIG_ENABLE
+            Timer0_accumulate_reload = ((timer->register_size == TIMER0_16BIT_REGISTER_MODE) && (0 == l_shift)) ? 1 : 0;
+#endif
+            TMR0H = (uint8)(l_preload >> 8);
+            TMR0L = (uint8)l_preload;
+            TIMER0_MODULE_ENABLE();
+#if TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+            INTCONbits.TMR0IE = l_interrupt;
+#endif
+            ret = E_OK;
+        }
+    }
+    return ret;
+}
+
 void TMR0_ISR(void){
+#if TIMER0_DRIFT_FREE_RELOAD_CONFIGURATION==CONFIG_ENABLE
+    uint8 l_tmr0l = 0;
+    uint16 l_reload = 0;
+#endif
     TIMER0_InterruptFlagClear();
+#if TIMER0_DRIFT_FREE_RELOAD_CONFIGURATION==CONFIG_ENABLE
+    if(1 == Timer0_accumulate_reload){
+        /* The counts elapsed since the overflow (entry latency) are kept , the next period starts at the overflow */
+        l_tmr0l = TMR0L;
+        l_reload = (uint16)((((uint16)TMR0H << 8) | l_tmr0l) + Timer0_preload + TIMER0_RELOAD_COMPENSATION_COUNTS);
+        TMR0H = (uint8)(l_reload >> 8);
+        TMR0L = (uint8)l_reload;
+    }
+    else{
+        TMR0H = (uint8)(Timer0_preload >> 8);
+        TMR0L = (uint8)Timer0_preload;
+    }
+#else
     TMR0H = (uint8)(Timer0_preload >> 8);
     TMR0L = (uint8)Timer0_preload;
+#endif
+#ifdef TIMER0_INTERRUPT_HANDLER
+    TIMER0_INTERRUPT_HANDLER();
+#else
     if(TMR0_InterruptHandler){
         TMR0_InterruptHandler();
     }
+#endif
 }
 
 static inline void timer0_prescaler_cfg(const timer0_t *timer){
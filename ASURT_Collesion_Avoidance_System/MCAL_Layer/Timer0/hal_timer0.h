@@ -12,6 +12,7 @@
 #include "../mcal_std_types.h"
 #include "../GPIO/hal_gpio.h"
 #include "../Interrupt/mcal_internal_interrupt.h"
+#include "hal_timer0_cfg.h"
 
 /* MACRO DECLARATIONS */
 #define TIMER0_PRESCALER_ENABLE_CFG  1
@@ -26,6 +27,13 @@
 #define TIMER0_8BIT_REGISTER_MODE    1
 #define TIMER0_16BIT_REGISTER_MODE   0
 
+/* Longest period reachable by timer0_set_period_us() : 16-bit register with the 1:256 prescaler */
+#define TIMER0_PERIOD_MAX_US         ((65536UL * 256UL) / (_XTAL_FREQ / 4000000UL))
+
+#if (_XTAL_FREQ % 4000000UL) != 0
+#error "The Timer0 period helpers need FOSC/4 to be a whole number of MHz"
+#endif
+
 /* MACRO FUNCTIONS DECLARATIONS */
 #define TIMER0_PRESCALER_ENABLE()    (T0CONbits.PSA = 0)
 #define TIMER0_PRESCALER_DISABLE()   (T0CONbits.PSA = 1)
@@ -42,6 +50,29 @@
 #define TIMER0_MODULE_ENABLE()          (T0CONbits.TMR0ON = 1)
 #define TIMER0_MODULE_DISABLE()         (T0CONbits.TMR0ON = 0)
 
+/* 
+ * Compile-time period (16-bit timer mode) : the smallest prescaler fitting the period is selected
+ * for the best resolution. The macros have no casts except TIMER0_PERIOD_PRELOAD so they can be
+ * range checked with #if TIMER0_PERIOD_IN_RANGE(_US)
+ */
+#define TIMER0_PERIOD_CYCLES(_US)           ((_XTAL_FREQ / 4000000UL) * (_US))
+#define TIMER0_PERIOD_FITS(_US, _DIV)       (TIMER0_PERIOD_CYCLES(_US) <= (65536UL * (_DIV)))
+#define TIMER0_PERIOD_IN_RANGE(_US)         ((TIMER0_PERIOD_CYCLES(_US) > 0UL) && TIMER0_PERIOD_FITS(_US, 256UL))
+#define TIMER0_PERIOD_PRESCALE(_US)         (TIMER0_PERIOD_FITS(_US, 1UL) ? 1UL : TIMER0_PERIOD_FITS(_US, 2UL) ? 2UL :          \
+                                             TIMER0_PERIOD_FITS(_US, 4UL) ? 4UL : TIMER0_PERIOD_FITS(_US, 8UL) ? 8UL :          \
+                                             TIMER0_PERIOD_FITS(_US, 16UL) ? 16UL : TIMER0_PERIOD_FITS(_US, 32UL) ? 32UL :      \
+                                             TIMER0_PERIOD_FITS(_US, 64UL) ? 64UL : TIMER0_PERIOD_FITS(_US, 128UL) ? 128UL : 256UL)
+#define TIMER0_PERIOD_PRESCALER_ENABLE(_US) ((1UL == TIMER0_PERIOD_PRESCALE(_US)) ? TIMER0_PRESCALER_DISABLE_CFG : TIMER0_PRESCALER_ENABLE_CFG)
+#define TIMER0_PERIOD_PRESCALER_VALUE(_US)  (TIMER0_PERIOD_FITS(_US, 2UL) ? TIMER0_PRESCALER_DIV_BY_2 :                        \
+                                             TIMER0_PERIOD_FITS(_US, 4UL) ? TIMER0_PRESCALER_DIV_BY_4 :                        \
+                                             TIMER0_PERIOD_FITS(_US, 8UL) ? TIMER0_PRESCALER_DIV_BY_8 :                        \
+                                             TIMER0_PERIOD_FITS(_US, 16UL) ? TIMER0_PRESCALER_DIV_BY_16 :                      \
+                                             TIMER0_PERIOD_FITS(_US, 32UL) ? TIMER0_PRESCALER_DIV_BY_32 :                      \
+                                             TIMER0_PERIOD_FITS(_US, 64UL) ? TIMER0_PRESCALER_DIV_BY_64 :                      \
+                                             TIMER0_PERIOD_FITS(_US, 128UL) ? TIMER0_PRESCALER_DIV_BY_128 : TIMER0_PRESCALER_DIV_BY_256)
+#define TIMER0_PERIOD_PRELOAD(_US)          ((uint16)(65536UL - ((TIMER0_PERIOD_CYCLES(_US) + (TIMER0_PERIOD_PRESCALE(_US) / 2UL))  \
+                                             / TIMER0_PERIOD_PRESCALE(_US))))
+
 /* DATA TYPES DECLARATIONS */
 typedef enum{
     TIMER0_PRESCALER_DIV_BY_2 = 0,
@@ -57,7 +88,7 @@ typedef enum{
 typedef struct{
 #if TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
     void (* TMR0_InterruptHandler)(void);
-//    interrupt_priority_t priority;
+    interrupt_priority_cfg priority;
 #endif
     timer0_prescaler_select_t prescaler_value;
     uint16 preload_value;
@@ -73,6 +104,7 @@ Std_ReturnType timer0_initialize(const timer0_t *timer);
 Std_ReturnType timer0_deinitialize(const timer0_t *timer);
 Std_ReturnType timer0_write_value(const timer0_t *timer, uint16 value);
 Std_ReturnType timer0_read_value(const timer0_t *timer, uint16 *value);
+Std_ReturnType timer0_set_period_us(const timer0_t *timer, uint32 period_us);
 
 #endif	/* HAL_TIMER0_H */
 
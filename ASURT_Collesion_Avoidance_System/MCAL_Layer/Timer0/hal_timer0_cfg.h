@@ -0,0 +1,38 @@
+/* 
+ * File:   hal_timer0_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 01:45 PM
+ */
+
+#ifndef HAL_TIMER0_CFG_H
+#define	HAL_TIMER0_CFG_H
+
+/***************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* 
+ * Drift-free reload : in 16-bit timer mode without prescaler the ISR adds the preload to the
+ * running count instead of overwriting it, so the interrupt latency does not stretch the period.
+ * Other modes keep the plain reload (writing TMR0 clears the prescaler).
+ */
+#define TIMER0_DRIFT_FREE_RELOAD_CONFIGURATION  CONFIG_ENABLE
+/* 
+ * Instruction cycles from the TMR0L read to the TMR0L write of the reload, plus the 2 cycles
+ * the write inhibits the increment. test/test_timer0_reload.c checks the reload on a cycle model
+ * of TMR0 : no drift when this value matches the ISR code , a fixed error of one count per period
+ * for every count it is off. The value itself is an UNVERIFIED estimate : recount it from the XC8
+ * listing of TMR0_ISR (or trim it until the tick period measured on a pin toggle is exact) when
+ * the compiler or its options change.
+ */
+#define TIMER0_RELOAD_COMPENSATION_COUNTS       8U
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* HAL_TIMER0_CFG_H */
+
@@ -1,5 +1,5 @@
 /* 
- * File:   hal_timer1.h
+ * File:   hal_timer1.c
  * Author: omar fathy
  *
  * Created on 14 July 2024, 12:59
@@ -9,11 +9,20 @@
 
 #if TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
 static void (* TMR1_InterruptHandler)(void) = NULL;
+#ifdef TIMER1_INTERRUPT_HANDLER
+void TIMER1_INTERRUPT_HANDLER(void);
+#endif
 #endif
 
-static uint16 Timer1_preload = ZERO_INIT;
+static uint16 Timer1_preload = 0;
+#if TIMER1_TIMEBASE_CONFIGURATION==CONFIG_ENABLE
+/* Upper 16 bits of the microsecond timebase, incremented on every Timer1 overflow */
+static volatile uint16 Timer1_overflows = 0;
+#endif
 
 static inline void timer1_mode_select(const timer1_t *timer);
+static inline void timer1_register_size_cfg(const timer1_t *timer);
+static inline void timer1_oscillator_cfg(const timer1_t *timer);
 
 /**
  * @brief Initialize the Timer1 module
@@ -30,22 +39,27 @@ Std_ReturnType timer1_initialize(const timer1_t *timer){
         TIMER1_MODULE_DISABLE();
         TIMER1_PRESCALER_SELECT(timer->prescaler_value);
         timer1_mode_select(timer);
+        timer1_register_size_cfg(timer);
+        timer1_oscillator_cfg(timer);
         TMR1H = (uint8)((timer->preload_value) >> 8);
         TMR1L = (uint8)(timer->preload_value);
         Timer1_preload = timer->preload_value;
+#if TIMER1_TIMEBASE_CONFIGURATION==CONFIG_ENABLE
+        Timer1_overflows = 0;
+#endif
 #if TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-        Timer1_Interrupt_Enable();
-        Timer1_Interrupt_FlagClear();
+        TIMER1_InterruptEnable();
+        TIMER1_InterruptFlagClear();
         TMR1_InterruptHandler = timer->TMR1_InterruptHandler;
 #if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityLevelsEnable();
-        if(timer->priority == INTERRUPT_PRIORITY_HIGH){
-            INTERRUPT_GlobalInterruptEnableHigh();
-            Timer1_SetHighPriority();
+        INTERRUPT_PriorityLevelEnable();
+        if(timer->priority == INTERRUPT_HIGH_PRIORITY){
+            INTERRUPT_GlobalInterruptHighEnable();
+            TIMER1_HighPrioritySet();
         }
-        else if(timer->priority == INTERRUPT_PRIORITY_LOW){
-            INTERRUPT_GlobalInterruptEnableLow();
-            Timer1_SetlowPriority();
+        else if(timer->priority == INTERRUPT_LOW_PRIORITY){
+            INTERRUPT_GlobalInterruptLowEnable();
+            TIMER1_LowPrioritySet();
         }
 #else
         INTERRUPT_GlobalInterruptEnable();
@@ -72,7 +86,7 @@ Std_ReturnType timer1_deinitialize(const timer1_t *timer){
     else{
         TIMER1_MODULE_DISABLE();
 #if TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-        Timer1_Interrupt_Disable();
+        TIMER1_InterruptDisable();
 #endif
         ret = E_OK;
     }
@@ -100,7 +114,7 @@ Std_ReturnType timer1_write_value(const timer1_t *timer, uint16 value){
 }
 
 /**
- * @brief Write value in the timer1 register
+ * @brief Read value from the timer1 register
  * @param timer (Pointer to the timer configuration)
  * @param value (Pointer to the value read from the timer register)
  * @return State of the function
@@ -112,22 +126,75 @@ Std_ReturnType timer1_read_value(const timer1_t *timer, uint16 *value){
         ret = E_NOT_OK;
     }
     else{
-        uint8 l_tmr1h = ZERO_INIT, l_tmr1l = ZERO_INIT;
-        l_tmr1h = TMR1H;
+        uint8 l_tmr1h = 0, l_tmr1l = 0;
+        /* In 16-bit mode TMR1H is a buffer latched when TMR1L is read, TMR1L must be read first */
         l_tmr1l = TMR1L;
+        l_tmr1h = TMR1H;
         *value = (uint16)((l_tmr1h << 8) + l_tmr1l);
         ret = E_OK;
     }
     return ret;
 }
 
+#if TIMER1_TIMEBASE_CONFIGURATION==CONFIG_ENABLE
+/**
+ * @brief Read the free-running 32-bit microsecond timebase (wraps every ~71.6 minutes)
+ * @note Safe from the main loop and from both interrupt priorities
+ * @param now_us (Pointer to the current time in microseconds)
+ * @return status of the function
+ *         (E_OK) : The function done successfully
+ *         (E_NOT_OK) : The function has issue to perform this action
+ */
+Std_ReturnType time_now_us(uint32 *now_us){
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_overflows = 0;
+    uint16 l_count = 0;
+    uint8 l_tmr1l = 0;
+    uint8 l_pending = 0;
+    
+    if(NULL == now_us){
+        ret = E_NOT_OK;
+    }
+    else{
+        /* Retry when the overflow ISR ran (or the 16-bit counter was torn) during the read */
+        do{
+            l_overflows = Timer1_overflows;
+            l_tmr1l = TMR1L;
+            l_count = (uint16)(((uint16)TMR1H << 8) | l_tmr1l);
+            l_pending = PIR1bits.TMR1IF;
+        }while(l_overflows != Timer1_overflows);
+        /* An overflow not serviced yet (interrupts masked by the caller) belongs to a count that wrapped */
+        if((INTERRUPT_OCCUR == l_pending) && (l_count < 0x8000U)){
+            l_overflows++;
+        }
+        else{ /* Nothing */ }
+        *now_us = ((uint32)l_overflows << 16) | l_count;
+        ret = E_OK;
+    }
+    return ret;
+}
+#endif
+
 void TMR1_ISR(void){
-    Timer1_Interrupt_FlagClear();
+#if TIMER1_TIMEBASE_CONFIGURATION==CONFIG_ENABLE
+    /* Free-running : no reload, count the overflow and clear the flag without a high priority reader in between */
+    uint8 l_gieh = INTCONbits.GIEH;
+    INTERRUPT_GlobalInterruptHighDisable();
+    Timer1_overflows++;
+    TIMER1_InterruptFlagClear();
+    INTCONbits.GIEH = l_gieh;
+#else
+    TIMER1_InterruptFlagClear();
     TMR1H = (uint8)(Timer1_preload >> 8);
     TMR1L = (uint8)Timer1_preload;
+#endif
+#ifdef TIMER1_INTERRUPT_HANDLER
+    TIMER1_INTERRUPT_HANDLER();
+#else
     if(TMR1_InterruptHandler){
         TMR1_InterruptHandler();
     }
+#endif
 }
 
 static inline void timer1_mode_select(const timer1_t *timer){
@@ -143,4 +210,22 @@ static inline void timer1_mode_select(const timer1_t *timer){
             TIMER1_SYNC_COUNTER_MODE_ENABLE();
         }
     }
-}
\ No newline at end of file
+}
+
+static inline void timer1_register_size_cfg(const timer1_t *timer){
+    if(timer->register_size == TIMER1_8BIT_REGISTER_MODE){
+        TIMER1_8BIT_REGISTER_MODE_ENABLE();
+    }
+    else if(timer->register_size == TIMER1_16BIT_REGISTER_MODE){
+        TIMER1_16BIT_REGISTER_MODE_ENABLE();
+    }
+}
+
+static inline void timer1_oscillator_cfg(const timer1_t *timer){
+    if(timer->oscillator_cfg == TIMER1_OSCILLATOR_ENABLE){
+        TIMER1_OSCILLATOR_HW_ENABLE();
+    }
+    else if(timer->oscillator_cfg == TIMER1_OSCILLATOR_DISABLE){
+        TIMER1_OSCILLATOR_HW_DISABLE();
+    }
+}
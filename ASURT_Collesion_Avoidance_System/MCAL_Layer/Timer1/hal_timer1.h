@@ -12,6 +12,7 @@
 #include "../mcal_std_types.h"
 #include "../GPIO/hal_gpio.h"
 #include "../Interrupt/mcal_internal_interrupt.h"
+#include "hal_timer1_cfg.h"
 
 /* MACRO DECLARATIONS */
 #define TIMER1_TIMER_MODE            0
@@ -29,6 +30,15 @@
 #define TIMER1_8BIT_REGISTER_MODE    0
 #define TIMER1_16BIT_REGISTER_MODE   1
 
+#if TIMER1_TIMEBASE_CONFIGURATION==CONFIG_ENABLE
+#if ((_XTAL_FREQ / 4UL) / TIMER1_TIMEBASE_PRESCALER_DIVIDER) != 1000000UL
+#error "TIMER1_TIMEBASE_PRESCALER_DIVIDER must give Timer1 a 1 MHz clock from _XTAL_FREQ"
+#endif
+#if TIMER1_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE
+#error "The Timer1 timebase counts its overflows in the Timer1 interrupt"
+#endif
+#endif
+
 /* MACRO FUNCTIONS DECLARATIONS */
 #define TIMER1_PRESCALER_SELECT(_PRESCALER) (T1CONbits.T1CKPS = _PRESCALER)
 
@@ -60,7 +70,7 @@ typedef enum{
 typedef struct{
 #if TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
     void (* TMR1_InterruptHandler)(void);
-    interrupt_priority_t priority;
+    interrupt_priority_cfg priority;
 #endif
     timer1_prescaler_select_t prescaler_value;
     uint8 operation_mode : 1;
@@ -76,6 +86,9 @@ Std_ReturnType timer1_initialize(const timer1_t *timer);
 Std_ReturnType timer1_deinitialize(const timer1_t *timer);
 Std_ReturnType timer1_write_value(const timer1_t *timer, uint16 value);
 Std_ReturnType timer1_read_value(const timer1_t *timer, uint16 *value);
+#if TIMER1_TIMEBASE_CONFIGURATION==CONFIG_ENABLE
+Std_ReturnType time_now_us(uint32 *now_us);
+#endif
 
 #endif	/* HAL_TIMER1_H */
 
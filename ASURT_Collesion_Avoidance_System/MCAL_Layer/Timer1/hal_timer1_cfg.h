@@ -0,0 +1,30 @@
+/* 
+ * File:   hal_timer1_cfg.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 02:15 PM
+ */
+
+#ifndef HAL_TIMER1_CFG_H
+#define	HAL_TIMER1_CFG_H
+
+/***************************************Includes***************************************/
+
+/***********************************Macro Declarations**********************************/
+
+/* 
+ * Free-running microsecond timebase : Timer1 is never reloaded, its overflows are counted in
+ * software to extend it to 32 bits and time_now_us() reads the extended value.
+ */
+#define TIMER1_TIMEBASE_CONFIGURATION       CONFIG_ENABLE
+/* Prescaler the timebase runs with, FOSC/4 divided by it must be 1 MHz (8 MHz / 4 / 2) */
+#define TIMER1_TIMEBASE_PRESCALER_DIVIDER   2UL
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/***********************************Function Declarations*******************************/
+
+#endif	/* HAL_TIMER1_CFG_H */
+
@@ -9,6 +9,9 @@
 
 #if TIMER2_INTERRUPT_FEATURE_ENABLE==INTERRUPT_FEATURE_ENABLE
 static void(* TMR2_InterruptHandler)(void) = NULL;
+#ifdef TIMER2_INTERRUPT_HANDLER
+void TIMER2_INTERRUPT_HANDLER(void);
+#endif
 #endif
 
 static volatile uint8 timer2_preload = 0;
@@ -127,13 +130,82 @@ Std_ReturnType Timer2_Read_value(const timer2_t *timer2 , uint8 *value){
     return retVal;
 }
 
+/**
+ * @brief Change the Timer2 interrupt period at runtime, the pre-scaler , post-scaler and PR2
+ *        giving the smallest error are selected and the timer restarts from 0
+ * @note PR2 also sets the CCP PWM period when Timer2 is the PWM time base
+ * @param timer2 pointer to the timer2 module configurations
+ * @param period_us the interrupt period in microseconds (TIMER2_PERIOD_MAX_US at most)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType Timer2_Set_Period_us(const timer2_t *timer2 , uint32 period_us){
+    Std_ReturnType retVal = E_NOT_OK;
+    /* Pre-scaler division indexed by the T2CKPS value */
+    static const uint8 l_prescaler_div[3] = {1 , 4 , 16};
+    uint32 l_cycles = 0;
+    uint32 l_error = 0;
+    uint32 l_best_error = 0xFFFFFFFFUL;
+    uint16 l_division = 0;
+    uint16 l_counts = 0;
+    uint8 l_prescaler = 0;
+    uint8 l_postscaler = 0;
+    uint8 l_best_prescaler = 0;
+    uint8 l_best_postscaler = 0;
+    uint8 l_best_pr2 = 0;
+    if((NULL == timer2) || (0 == period_us) || (TIMER2_PERIOD_MAX_US < period_us)){
+        retVal = E_NOT_OK;
+    }
+    else{
+        l_cycles = TIMER2_PERIOD_CYCLES(period_us);
+        /* Smallest pre-scaler first : on equal error the finest PWM resolution is kept */
+        for(l_prescaler = 0 ; l_prescaler < 3U ; l_prescaler++){
+            for(l_postscaler = 1 ; l_postscaler <= 16U ; l_postscaler++){
+                l_division = (uint16)(l_prescaler_div[l_prescaler] * l_postscaler);
+                l_counts = (uint16)((l_cycles + (l_division / 2U)) / l_division);
+                if((1U <= l_counts) && (256U >= l_counts)){
+                    l_error = ((uint32)l_counts * l_division > l_cycles) ? 
+                        (((uint32)l_counts * l_division) - l_cycles) : (l_cycles - ((uint32)l_counts * l_division));
+                    if(l_error < l_best_error){
+                        l_best_error = l_error;
+                        l_best_prescaler = l_prescaler;
+                        l_best_postscaler = (uint8)(l_postscaler - 1U);
+                        l_best_pr2 = (uint8)(l_counts - 1U);
+                    }
+                    else{ /* Nothing */ }
+                }
+                else{ /* Nothing */ }
+            }
+        }
+        if(0xFFFFFFFFUL == l_best_error){
+            retVal = E_NOT_OK;
+        }
+        else{
+            TIMER2_MODULE_DISABLE();
+            TIMER2_PRESCALER_SELECT(l_best_prescaler);
+            TIMER2_POSTSCALER_SELECT(l_best_postscaler);
+            PR2 = l_best_pr2;
+            /* The period is set by PR2 only , the ISR must not preload TMR2 anymore */
+            timer2_preload = 0;
+            TMR2 = 0;
+            TIMER2_MODULE_ENABLE();
+            retVal = E_OK;
+        }
+    }
+    return retVal;
+}
 
 /*---------------------------------------------- ISR --------------------------------------------------*/
 
 void TMR2_ISR(void){
     TIMER2_InterruptFlagClear();
     TMR2 = timer2_preload;
+#ifdef TIMER2_INTERRUPT_HANDLER
+    TIMER2_INTERRUPT_HANDLER();
+#else
     if(TMR2_InterruptHandler){
         TMR2_InterruptHandler();
     }
+#endif
 }
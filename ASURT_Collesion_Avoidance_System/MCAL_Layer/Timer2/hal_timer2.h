@@ -40,6 +40,13 @@
 #define TIMER2_PRESCALER_DIV_BY_4       1
 #define TIMER2_PRESCALER_DIV_BY_16      2
 
+/* Longest interrupt period reachable by Timer2_Set_Period_us() : PR2 = 255 , 1:16 prescaler , 1:16 postscaler */
+#define TIMER2_PERIOD_MAX_US            ((256UL * 16UL * 16UL) / (_XTAL_FREQ / 4000000UL))
+
+#if (_XTAL_FREQ % 4000000UL) != 0
+#error "The Timer2 period helpers need FOSC/4 to be a whole number of MHz"
+#endif
+
 /******************************Macro Function Declarations******************************/
 
 /* Enable Timer2 module */
@@ -53,6 +60,16 @@
 /* Timer2 Input Clock Post-Scaler */
 #define TIMER2_POSTSCALER_SELECT(_POSTSCALER_) (T2CONbits.TOUTPS = _POSTSCALER_)
 
+/* 
+ * Compile-time period for a chosen pre-scaler and post-scaler division (1/4/16 and 1..16),
+ * interrupt period = (PR2 + 1) * pre-scaler * post-scaler instruction cycles.
+ * Check the range with #if TIMER2_PERIOD_IN_RANGE(_US , _PRE , _POST) before using TIMER2_PERIOD_PR2
+ */
+#define TIMER2_PERIOD_CYCLES(_US)                  ((_XTAL_FREQ / 4000000UL) * (_US))
+#define TIMER2_PERIOD_COUNTS(_US, _PRE, _POST)     ((TIMER2_PERIOD_CYCLES(_US) + (((_PRE) * (_POST)) / 2UL)) / ((_PRE) * (_POST)))
+#define TIMER2_PERIOD_IN_RANGE(_US, _PRE, _POST)   ((TIMER2_PERIOD_COUNTS(_US, _PRE, _POST) >= 1UL) && (TIMER2_PERIOD_COUNTS(_US, _PRE, _POST) <= 256UL))
+#define TIMER2_PERIOD_PR2(_US, _PRE, _POST)        ((uint8)(TIMER2_PERIOD_COUNTS(_US, _PRE, _POST) - 1UL))
+
 /***********************************Datatype Declarations*******************************/
 
 typedef struct{
@@ -102,6 +119,17 @@ Std_ReturnType Timer2_Write_value(const timer2_t *timer2 , uint8 value);
  *          (E_NOT_OK) : the function has issue to perform this action
  */
 Std_ReturnType Timer2_Read_value(const timer2_t *timer2 , uint8 *value);
+/**
+ * @brief Change the Timer2 interrupt period at runtime, the pre-scaler , post-scaler and PR2
+ *        giving the smallest error are selected and the timer restarts from 0
+ * @note PR2 also sets the CCP PWM period when Timer2 is the PWM time base
+ * @param timer2 pointer to the timer2 module configurations
+ * @param period_us the interrupt period in microseconds (TIMER2_PERIOD_MAX_US at most)
+ * @return status of the function
+ *          (E_OK) : the function done successfully
+ *          (E_NOT_OK) : the function has issue to perform this action
+ */
+Std_ReturnType Timer2_Set_Period_us(const timer2_t *timer2 , uint32 period_us);
 
 #endif	/* HAL_TIMER2_H */
 
@@ -0,0 +1,165 @@
+/* 
+ * File:   hal_timer3.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 02:40 PM
+ */
+
+#include "hal_timer3.h"
+
+#if TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+static void (* TMR3_InterruptHandler)(void) = NULL;
+#ifdef TIMER3_INTERRUPT_HANDLER
+void TIMER3_INTERRUPT_HANDLER(void);
+#endif
+#endif
+
+static uint16 Timer3_preload = 0;
+
+static inline void timer3_mode_select(const timer3_t *timer);
+static inline void timer3_register_size_cfg(const timer3_t *timer);
+
+/**
+ * @brief Initialize the Timer3 module
+ * @param timer (Pointer to the timer configuration)
+ * @return State of the function
+ */
+Std_ReturnType timer3_initialize(const timer3_t *timer){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(timer == NULL){
+        ret = E_NOT_OK;
+    }
+    else{
+        TIMER3_MODULE_DISABLE();
+        TIMER3_PRESCALER_SELECT(timer->prescaler_value);
+        timer3_mode_select(timer);
+        timer3_register_size_cfg(timer);
+        TMR3H = (uint8)((timer->preload_value) >> 8);
+        TMR3L = (uint8)(timer->preload_value);
+        Timer3_preload = timer->preload_value;
+#if TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+        TIMER3_InterruptEnable();
+        TIMER3_InterruptFlagClear();
+        TMR3_InterruptHandler = timer->TMR3_InterruptHandler;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+        INTERRUPT_PriorityLevelEnable();
+        if(timer->priority == INTERRUPT_HIGH_PRIORITY){
+            INTERRUPT_GlobalInterruptHighEnable();
+            TIMER3_HighPrioritySet();
+        }
+        else if(timer->priority == INTERRUPT_LOW_PRIORITY){
+            INTERRUPT_GlobalInterruptLowEnable();
+            TIMER3_LowPrioritySet();
+        }
+#else
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif
+#endif
+        TIMER3_MODULE_ENABLE();
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Deinitialize the Timer3 module
+ * @param timer (Pointer to the timer configuration)
+ * @return State of the function
+ */
+Std_ReturnType timer3_deinitialize(const timer3_t *timer){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(timer == NULL){
+        ret = E_NOT_OK;
+    }
+    else{
+        TIMER3_MODULE_DISABLE();
+#if TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+        TIMER3_InterruptDisable();
+#endif
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Write value in the timer3 register
+ * @param timer (Pointer to the timer configuration)
+ * @param value (The value to write in the timer register)
+ * @return State of the function
+ */
+Std_ReturnType timer3_write_value(const timer3_t *timer, uint16 value){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if(timer == NULL){
+        ret = E_NOT_OK;
+    }
+    else{
+        TMR3H = (uint8)(value >> 8);
+        TMR3L = (uint8)(value);
+        ret = E_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Read value from the timer3 register
+ * @param timer (Pointer to the timer configuration)
+ * @param value (Pointer to the value read from the timer register)
+ * @return State of the function
+ */
+Std_ReturnType timer3_read_value(const timer3_t *timer, uint16 *value){
+    Std_ReturnType ret = E_NOT_OK;
+    
+    if((timer == NULL) || (value == NULL)){
+        ret = E_NOT_OK;
+    }
+    else{
+        uint8 l_tmr3h = 0, l_tmr3l = 0;
+        /* In 16-bit mode TMR3H is a buffer latched when TMR3L is read, TMR3L must be read first */
+        l_tmr3l = TMR3L;
+        l_tmr3h = TMR3H;
+        *value = (uint16)((l_tmr3h << 8) + l_tmr3l);
+        ret = E_OK;
+    }
+    return ret;
+}
+
+void TMR3_ISR(void){
+    TIMER3_InterruptFlagClear();
+    TMR3H = (uint8)(Timer3_preload >> 8);
+    TMR3L = (uint8)Timer3_preload;
+#ifdef TIMER3_INTERRUPT_HANDLER
+    TIMER3_INTERRUPT_HANDLER();
+#else
+    if(TMR3_InterruptHandler){
+        TMR3_InterruptHandler();
+    }
+#endif
+}
+
+static inline void timer3_mode_select(const timer3_t *timer){
+    if(timer->operation_mode == TIMER3_TIMER_MODE){
+        TIMER3_TIMER_MODE_ENABLE();
+    }
+    else if(timer->operation_mode == TIMER3_COUNTER_MODE){
+        TIMER3_COUNTER_MODE_ENABLE();
+        if(timer->counter_mode == TIMER3_ASYNC_COUNTER_MODE){
+            TIMER3_ASYNC_COUNTER_MODE_ENABLE();
+        }
+        else if(timer->counter_mode == TIMER3_SYNC_COUNTER_MODE){
+            TIMER3_SYNC_COUNTER_MODE_ENABLE();
+        }
+    }
+}
+
+static inline void timer3_register_size_cfg(const timer3_t *timer){
+    if(timer->register_size == TIMER3_8BIT_REGISTER_MODE){
+        TIMER3_8BIT_REGISTER_MODE_ENABLE();
+    }
+    else if(timer->register_size == TIMER3_16BIT_REGISTER_MODE){
+        TIMER3_16BIT_REGISTER_MODE_ENABLE();
+    }
+}
@@ -0,0 +1,69 @@
+/* 
+ * File:   hal_timer3.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 02:40 PM
+ */
+
+#ifndef HAL_TIMER3_H
+#define	HAL_TIMER3_H
+
+/* INCLUDES */
+#include "../mcal_std_types.h"
+#include "../GPIO/hal_gpio.h"
+#include "../Interrupt/mcal_internal_interrupt.h"
+
+/* MACRO DECLARATIONS */
+#define TIMER3_TIMER_MODE            0
+#define TIMER3_COUNTER_MODE          1
+
+#define TIMER3_ASYNC_COUNTER_MODE    1
+#define TIMER3_SYNC_COUNTER_MODE     0
+
+#define TIMER3_8BIT_REGISTER_MODE    0
+#define TIMER3_16BIT_REGISTER_MODE   1
+
+/* MACRO FUNCTIONS DECLARATIONS */
+#define TIMER3_PRESCALER_SELECT(_PRESCALER) (T3CONbits.T3CKPS = _PRESCALER)
+
+#define TIMER3_TIMER_MODE_ENABLE()          (T3CONbits.TMR3CS = 0)
+#define TIMER3_COUNTER_MODE_ENABLE()        (T3CONbits.TMR3CS = 1)
+
+#define TIMER3_ASYNC_COUNTER_MODE_ENABLE()  (T3CONbits.T3SYNC = 1)
+#define TIMER3_SYNC_COUNTER_MODE_ENABLE()   (T3CONbits.T3SYNC = 0)
+
+#define TIMER3_8BIT_REGISTER_MODE_ENABLE()  (T3CONbits.RD16 = 0)
+#define TIMER3_16BIT_REGISTER_MODE_ENABLE() (T3CONbits.RD16 = 1)
+
+#define TIMER3_MODULE_ENABLE()              (T3CONbits.TMR3ON = 1)
+#define TIMER3_MODULE_DISABLE()             (T3CONbits.TMR3ON = 0)
+
+/* DATA TYPES DECLARATIONS */
+typedef enum{
+    TIMER3_PRESCALER_DIV_BY_1 = 0,
+    TIMER3_PRESCALER_DIV_BY_2,
+    TIMER3_PRESCALER_DIV_BY_4,
+    TIMER3_PRESCALER_DIV_BY_8,
+}timer3_prescaler_select_t;
+
+typedef struct{
+#if TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    void (* TMR3_InterruptHandler)(void);
+    interrupt_priority_cfg priority;
+#endif
+    timer3_prescaler_select_t prescaler_value;
+    uint8 operation_mode : 1;
+    uint8 counter_mode : 1;
+    uint16 preload_value;
+    uint8 register_size : 1;
+    uint8 timer3_reserved : 5;
+}timer3_t;
+
+/* FUNCTIONS DECLARATIONS */
+Std_ReturnType timer3_initialize(const timer3_t *timer);
+Std_ReturnType timer3_deinitialize(const timer3_t *timer);
+Std_ReturnType timer3_write_value(const timer3_t *timer, uint16 value);
+Std_ReturnType timer3_read_value(const timer3_t *timer, uint16 *value);
+
+#endif	/* HAL_TIMER3_H */
+
@@ -8,30 +8,92 @@
 
 extern void ADC_DefaultInterruptHandler(void);
 extern void Timer0_DefaultInterruptHandler(void);
+extern void EUSART_RxDefaultInterruptHandler(void);
+extern void CCP2_DefaultInterruptHandler(void);
+extern void Timer3_DefaultInterruptHandler(void);
 
 eusart_t eusart_1 = {
     .EUSART_TxInterruptHandler = NULL,
-    .EUSART_RxInterruptHandler = NULL,
+    .EUSART_RxInterruptHandler = EUSART_RxDefaultInterruptHandler,
     .EUSART_FramingErrorHandler = NULL,
     .EUSART_OverrunErrorHandler = NULL,
-    .baudrate = 9600,
-    .baudrate_config = BAUDRATE_ASYN_8BIT_lOW_SPEED,
+    .baudrate_brg_value = EUSART_BRG_BEST_VALUE(EUSART_ASYNC_BAUDRATE),
+    .baudrate_config = EUSART_BRG_BEST_MODE(EUSART_ASYNC_BAUDRATE),
     .eusart_tx_cfg.eusart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE,
     .eusart_tx_cfg.eusart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE,
     .eusart_tx_cfg.eusart_tx_9bit_enable = EUSART_ASYNCHRONOUS_9Bit_TX_DISABLE,
+    .eusart_tx_cfg.eusart_tx_interrupt_priority = INTERRUPT_LOW_PRIORITY,
     .eusart_rx_cfg.eusart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE,
-    .eusart_rx_cfg.eusart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_DISABLE,
+    .eusart_rx_cfg.eusart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE,
     .eusart_rx_cfg.eusart_rx_9bit_enable = EUSART_ASYNCHRONOUS_9Bit_RX_DISABLE,
+    .eusart_rx_cfg.eusart_rx_interrupt_priority = INTERRUPT_LOW_PRIORITY,
+    .eusart_rx_cfg.eusart_rx_address_detect_enable = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE,
+    .node_address = 0x01,
 };
 
+timer0_t timer0_obj = {
+    .TMR0_InterruptHandler = Timer0_DefaultInterruptHandler,
+    .priority = INTERRUPT_HIGH_PRIORITY,
+    .operation_mode = TIMER0_TIMER_MODE,
+    .register_size = TIMER0_16BIT_REGISTER_MODE,
+    .prescaler_enable = TIMER0_PERIOD_PRESCALER_ENABLE(1000UL),
+    .prescaler_value = TIMER0_PERIOD_PRESCALER_VALUE(1000UL),
+    .preload_value = TIMER0_PERIOD_PRELOAD(1000UL)      /* 1 ms tick until scheduler_init() applies SCHEDULER_TICK_PERIOD_US */
+};
+
+timer1_t timer1_obj = {
+    .TMR1_InterruptHandler = NULL,
+    .priority = INTERRUPT_LOW_PRIORITY,
+    .operation_mode = TIMER1_TIMER_MODE,
+    .counter_mode = TIMER1_SYNC_COUNTER_MODE,
+    .oscillator_cfg = TIMER1_OSCILLATOR_DISABLE,
+    .register_size = TIMER1_16BIT_REGISTER_MODE,
+    .prescaler_value = TIMER1_PRESCALER_DIV_BY_2,
+    .preload_value = 0          /* Free-running 1 us timebase : FOSC/4 = 2 MHz / 2 */
+};
+
+#ifdef SENSOR_NODE_BUILD
+/* Sensor input on AN0 , converted on the Timer0 tick and read back by the ADC interrupt */
+adc_config_t adc_1 = {
+    .ADC_InterruptHandler = ADC_DefaultInterruptHandler,
+    .priotiry = INTERRUPT_LOW_PRIORITY,
+    .acquisition_time = ADC_12_TAD,
+    .conversion_clock = ADC_CONVERSION_CLOCK_FOSC_DIV_16,
+    .adc_channel = ADC_CHANNEL_AN0,
+    .result_format = ADC_RIGHT_FORMAT,
+    .voltage_reference = ADC_VOLTAGE_REF_DISABLE
+};
+
+/* Ultrasonic echo on RC1 , both edges are captured against the Timer1 timebase */
+ccp_t ccp2_capture = {
+    .ccp_inst = CCP2_INST,
+    .CCP2_InterruptHandler = CCP2_DefaultInterruptHandler,
+    .CCP2_priority = INTERRUPT_LOW_PRIORITY,
+    .ccp_mode = CCP_CAPTURE_MODE_SELECTED,
+    .ccp_mode_variant = CCP_CAPTURE_MODE_1_RISING_EDGE,
+    .ccp_capture_timer = CCP1_CCP2_TIMER1,
+    .ccp_pin.port = PORTC_INDEX,
+    .ccp_pin.pin = GPIO_PIN1,
+    .ccp_pin.direction = GPIO_DIRECTION_INPUT,
+};
+
+/* Ultrasonic trigger pulse and echo timeout , one-shot periods in us rearmed by the driver */
+timer3_t timer3_obj = {
+    .TMR3_InterruptHandler = Timer3_DefaultInterruptHandler,
+    .priority = INTERRUPT_LOW_PRIORITY,
+    .prescaler_value = TIMER3_PRESCALER_DIV_BY_2,
+    .operation_mode = TIMER3_TIMER_MODE,
+    .counter_mode = TIMER3_SYNC_COUNTER_MODE,
+    .register_size = TIMER3_16BIT_REGISTER_MODE,
+    .preload_value = 0
+};
+#else
 ccp_t ccp1_pwm = {
     .ccp_inst = CCP1_INST,
     .CCP1_InterruptHandler = NULL,
     .CCP1_priority = INTERRUPT_LOW_PRIORITY,
     .ccp_mode = CCP_PWM_MODE_SELECTED,
-    .PWM_Frequency = 50000,
-    .timer2_prescaler_value = CCP_TIMER2_PRESCALER_DIV_BY_1,
-    .timer2_postscaler_value = CCP_TIMER2_POSTSCALER_DIV_BY_1,
+    .PWM_Frequency = 2000,      /* Buzzer tone , changed per warning zone */
     .ccp_pin.port = PORTC_INDEX,
     .ccp_pin.pin = GPIO_PIN2,
     .ccp_pin.direction = GPIO_DIRECTION_OUTPUT,
@@ -39,37 +101,29 @@ ccp_t ccp1_pwm = {
 
 timer2_t timer = {
   .TMR2_InterruptHandler = NULL,
+  .priority = INTERRUPT_LOW_PRIORITY,
   .timer2_prescaler = TIMER2_PRESCALER_DIV_BY_1,
   .timer2_postscaler = TIMER2_POSTSCALER_DIV_BY_1,
   .timer2_preload_value = 0,
 };
-
-timer0_t timer0_obj = {
-    .TMR0_InterruptHandler = Timer0_DefaultInterruptHandler,
-    .operation_mode = TIMER0_TIMER_MODE,
-    .register_size = TIMER0_16BIT_REGISTER_MODE,
-    .prescaler_enable = TIMER0_PRESCALER_ENABLE_CFG,
-    .prescaler_value = TIMER0_PRESCALER_DIV_BY_16,
-    .preload_value = 3036
-};
-
-//adc_config_t adc_1 = {
-//    .ADC_InterruptHandler = ADC_DefaultInterruptHandler,
-//    .acquisition_time = ADC_12_TAD,
-//    .conversion_clock = ADC_CONVERSION_CLOCK_FOSC_DIV_16,
-//    .adc_channel = ADC_CHANNEL_AN0,
-//    .result_format = ADC_RIGHT_FORMAT,
-//    .voltage_reference = ADC_VOLTAGE_REF_DISABLE
-//};
+#endif
 
 void mcal_layer_initialize(void){
     Std_ReturnType retVal = E_NOT_OK; //fixed
     
     retVal = EUSART_ASYNC_Init(&eusart_1);
     
-    retVal = CCP_Init(&ccp1_pwm);
     retVal = timer0_initialize(&timer0_obj);
+    retVal = timer1_initialize(&timer1_obj);
+#ifdef SENSOR_NODE_BUILD
+    retVal = ADC_Init(&adc_1);
+    retVal = timer3_initialize(&timer3_obj);
+    retVal = CCP_Init(&ccp2_capture);
+#else
+    /* Timer2 first : Timer2_Init() writes its own prescaler , CCP_Init() then sets the prescaler and PR2 of PWM_Frequency */
     retVal = Timer2_Init(&timer);
-    
-//    retVal = ADC_Init(&adc_1);
+    /* PWM timebase only : its period interrupt has no handler and would wake the receiver idle loop at the tone rate */
+    TIMER2_InterruptDisable();
+    retVal = CCP_Init(&ccp1_pwm);
+#endif
 }
\ No newline at end of file
@@ -15,7 +15,9 @@
 #include "CCP/hal_ccp.h"
 #include "EUSART/hal_eusart.h"
 #include "Timer0/hal_timer0.h"
+#include "Timer1/hal_timer1.h"
 #include "Timer2/hal_timer2.h"
+#include "Timer3/hal_timer3.h"
 
 /***********************************Macro Declarations**********************************/
 
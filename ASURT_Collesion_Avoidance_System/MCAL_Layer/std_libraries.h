@@ -25,7 +25,10 @@
 #define CPU_TYPE_32 32
 #define CPU_TYPE_64 64
 /*************************************/
-#define CPU_TYPE (CPU_TYPE_64)
+/* Overridden by the host test build (test/Makefile) where long is 64 bits wide */
+#ifndef CPU_TYPE
+#define CPU_TYPE (CPU_TYPE_8)
+#endif
 /*************************************/
 #if (CPU_TYPE == CPU_TYPE_64)
 typedef unsigned char boolean;
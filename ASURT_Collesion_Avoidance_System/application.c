@@ -12,15 +12,97 @@
 //volatile uint8 adc_req;
 //uint8 uart_sent_data;
 
-volatile uint8 uart_received_data;
+/* Last distance (cm) received in a valid frame, starts out of range until the first frame */
+uint16 link_distance = 0xFFFF;
+static uint8 uart_rx_bytes[EUSART_RX_BUFFER_SIZE];
+static link_frame_parser_t link_parser;
+static link_speed_t link_speed;
+/* Single producer : the EUSART RX interrupt (low priority level) */
+static event_queue_t application_low_events;
+/* Set while an UART RX event is queued, one event drains every byte buffered so far */
+static volatile uint8 uart_rx_event_pending = 0;
+/* Arrival time (time_now_us) of the last byte received, written by the EUSART RX interrupt */
+static volatile uint32 uart_rx_timestamp_us = 0;
+
+static void application_uart_rx_process(void);
+static void application_alert_task(void);
+static void application_link_task(void);
+static void application_alert_blink(void);
+static void application_buzzer_toggle(void);
+static void application_buzzer_output(uint8 _sounding);
+static void application_buzzer_cadence_update(uint16 _distance);
+static void application_zone_apply(void);
+static void application_failsafe_apply(void);
+static void application_report_task(void);
+static void application_idle(uint16 _last_ticks);
+static void application_wake_latency_record(void);
+
+/* Declares the link stale when no valid frame arrives for LINK_SUPERVISOR_TIMEOUT */
+static link_supervisor_t link_supervisor;
+/* Closing speed tracker between the receive path and the warning zones */
+static ttc_estimator_t application_ttc;
+/* Warning zone of the latest distance, updated by the receive path and applied by the alert task */
+static alert_zone_t application_zone;
+static uint8 application_zone_pending = 0;
+/* Toggles the LED at the period of the current zone */
+static soft_timer_t alert_blink_timer;
+/* Toggles the buzzer every (zone ms per cm) x distance ms bounded by the zone, its period follows the latest distance */
+static soft_timer_t buzzer_cadence_timer;
+/* Buzzer state and the PWM tone of the current zone (0 : plain output) */
+static uint8 buzzer_sounding = 0;
+static uint32 buzzer_tone_hz = 0;
+
+/* Statistics of the last report window , watched from the debugger */
+application_stats_t application_stats;
+/* Report window : IDLE time and wake ups , counted by the main loop only */
+static uint32 application_window_start_us = 0;
+static uint32 application_idle_us = 0;
+static uint16 application_wakeups = 0;
+/* Wake up time of the last IDLE period , application_woken is cleared by the first handler after it */
+static uint32 application_wake_us = 0;
+static uint8 application_woken = 0;
+static uint32 application_latency_sum_us = 0;
+static uint32 application_latency_max_us = 0;
+static uint16 application_latency_count = 0;
+
+/* Cooperative tasks released by the 1 ms Timer0 tick, run to completion from the main loop */
+static const scheduler_task_t application_tasks[] = {
+    {application_alert_task , APPLICATION_ALERT_TASK_PERIOD , APPLICATION_ALERT_TASK_OFFSET},
+    {application_link_task  , APPLICATION_LINK_TASK_PERIOD  , APPLICATION_LINK_TASK_OFFSET},
+    {application_report_task , APPLICATION_REPORT_TASK_PERIOD , APPLICATION_REPORT_TASK_OFFSET}
+};
 
 int main() {
-    Std_ReturnType retVal = E_NOT_OK; //fixed
+    event_t event;
+    uint16 ticks = 0;
+    uint16 last_ticks = 0;
+    uint8 busy = 0;
     application_initialize(); //fixed
 
     while(1){
-
-        retVal = EUSART_ASYNC_Read_Byte_Blocking(&eusart_1 , &uart_received_data);
+        busy = 0;
+        /* Bottom half of the interrupts : the ISRs only post events , the handlers run here */
+        while(E_OK == event_queue_get(&application_low_events , &event)){
+            application_wake_latency_record();
+            application_event_dispatch(&event);
+            busy = 1;
+        }
+        /* Tasks and soft timers are only released on a tick , an unchanged tick leaves nothing to run */
+        if((E_OK == scheduler_get_ticks(&ticks)) && (ticks != last_ticks)){
+            last_ticks = ticks;
+            application_wake_latency_record();
+            (void)scheduler_dispatch();
+            (void)soft_timer_process(ticks);
+            busy = 1;
+        }
+        else{ /* Nothing */ }
+#if APPLICATION_IDLE_MODE==CONFIG_ENABLE
+        /* Nothing ran : wait for the next interrupt instead of polling */
+        if(0 == busy){
+            application_idle(last_ticks);
+        }
+        else{ /* Nothing */ }
+#endif
 
 //        if(0 == adc_req){
 //            retVal = ADC_Start_Conversion_Interrupt(&adc_1 , ADC_CHANNEL_AN0);
@@ -43,18 +125,294 @@ int main() {
 //}
 
 void Timer0_DefaultInterruptHandler(void){
-    if(50 >= uart_received_data){
-        led_toggle(&led_1);
-        led_toggle(&buzzer);
-    }
-    else{
-        led_turn_off(&led_1);
-        led_turn_off(&buzzer);
+    scheduler_tick();
+}
+
+void EUSART_RxDefaultInterruptHandler(void){
+    uint32 l_now_us = 0;
+    (void)time_now_us(&l_now_us);
+    uart_rx_timestamp_us = l_now_us;
+    if(0 == uart_rx_event_pending){
+        uart_rx_event_pending = 1;
+        (void)event_queue_post(&application_low_events , APPLICATION_EVENT_UART_RX , 0);
     }
+    else{ /* Nothing */ }
 }
 
 void application_initialize(void){
     Std_ReturnType retVal = E_NOT_OK; //fixed
     ecu_layer_initialize(); //fixed 
     mcal_layer_initialize(); //fixed
+    retVal = event_queue_init(&application_low_events);
+    retVal = link_frame_parser_init(&link_parser);
+    /* The display node measures the sensor node with auto-baud and answers its speed requests */
+    retVal = link_speed_init(&link_speed , &eusart_1 , &link_parser , LINK_SPEED_RESPONDER);
+    retVal = scheduler_init(&timer0_obj , application_tasks , (uint8)(sizeof(application_tasks) / sizeof(application_tasks[0])));
+    retVal = soft_timer_init(0);
+    retVal = link_supervisor_init(&link_supervisor , 0);
+    retVal = ttc_estimator_reset(&application_ttc);
+    retVal = alert_zone_init(&application_zone);
+    retVal = soft_timer_create(&alert_blink_timer , application_alert_blink , APPLICATION_ALERT_DEFAULT_PERIOD , SOFT_TIMER_PERIODIC);
+    retVal = soft_timer_create(&buzzer_cadence_timer , application_buzzer_toggle , APPLICATION_ALERT_DEFAULT_PERIOD , SOFT_TIMER_PERIODIC);
+#if APPLICATION_IDLE_MODE==CONFIG_ENABLE
+    /* SLEEP enters the IDLE mode : only the CPU clock stops , Timer0 , Timer1 , the EUSART and the tone keep running */
+    OSCCONbits.IDLEN = 1;
+#endif
+    retVal = time_now_us(&application_window_start_us);
+}
+
+void application_update_distance(const link_frame_t *frame , uint32 timestamp_us){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 l_changed = 0;
+    uint16 l_ttc_ms = TTC_ESTIMATOR_NONE;
+    uint16 l_distance = frame->distance;
+    if(LINK_FRAME_FLAG_NO_ECHO == (frame->flags & LINK_FRAME_FLAG_NO_ECHO)){
+        l_distance = 0xFFFF;
+    }
+    link_distance = l_distance;
+#if APPLICATION_TTC_MODE==CONFIG_ENABLE
+    /* An out of range distance (no echo included) restarts the track */
+    retVal = ttc_estimator_update(&application_ttc , l_distance , timestamp_us , &l_ttc_ms);
+#endif
+    retVal = alert_zone_update(&application_zone , l_distance , l_ttc_ms , &l_changed);
+    if(1 == l_changed){
+        application_zone_pending = 1;
+    }
+    else{ /* Nothing */ }
+    application_buzzer_cadence_update(l_distance);
+}
+
+void application_event_dispatch(const event_t *event){
+    switch(event->id){
+        case APPLICATION_EVENT_UART_RX :
+            application_uart_rx_process();
+            break;
+        default : 
+            break;
+    }
+}
+
+static void application_uart_rx_process(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 rx_length = 0;
+    uint8 rx_index = 0;
+    uint8 frame_ready = 0;
+    uint8 frame_consumed = 0;
+    uint8 link_recovered = 0;
+    uint16 rx_tick = 0;
+    uint32 rx_timestamp_us = 0;
+    link_frame_t rx_frame;
+    /* Cleared before draining so a byte buffered from now on posts a new event */
+    uart_rx_event_pending = 0;
+    /* The frames drained now share the arrival time of the last byte , re-read if the ISR wrote it meanwhile */
+    do{
+        rx_timestamp_us = uart_rx_timestamp_us;
+    }while(rx_timestamp_us != uart_rx_timestamp_us);
+    /* Bytes are buffered by the EUSART RX interrupt and fed to the frame parser one by one */
+    retVal = EUSART_ASYNC_Read_Buffer(&eusart_1 , uart_rx_bytes , EUSART_RX_BUFFER_SIZE , &rx_length);
+    if(E_OK != retVal){
+        rx_length = 0;
+    }
+    for(rx_index = 0 ; rx_index < rx_length ; rx_index++){
+        retVal = link_frame_parser_feed(&link_parser , uart_rx_bytes[rx_index] , &rx_frame , &frame_ready);
+        if(1 == frame_ready){
+            /* Any valid frame , control frames included , proves the sensor node alive */
+            retVal = scheduler_get_ticks(&rx_tick);
+            retVal = link_supervisor_frame_received(&link_supervisor , rx_tick , &link_recovered);
+            if(1 == link_recovered){
+                application_zone_pending = 1;
+            }
+            else{ /* Nothing */ }
+            retVal = link_speed_frame_received(&link_speed , &rx_frame , &frame_consumed);
+            if(0 == frame_consumed){
+                application_update_distance(&rx_frame , rx_timestamp_us);
+            }
+        }
+    }
+}
+
+static void application_link_task(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    retVal = link_speed_periodic(&link_speed);
+}
+
+/* The outputs only change on a zone transition, a reading chattering inside a hysteresis band is ignored */
+static void application_alert_task(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint16 l_now = 0;
+    uint8 l_went_stale = 0;
+    uint8 l_stale = 0;
+    retVal = scheduler_get_ticks(&l_now);
+    retVal = link_supervisor_periodic(&link_supervisor , l_now , &l_went_stale);
+    retVal = link_supervisor_is_stale(&link_supervisor , &l_stale);
+    if(1 == l_went_stale){
+        application_failsafe_apply();
+    }
+    else if((0 == l_stale) && (1 == application_zone_pending)){
+        application_zone_pending = 0;
+        application_zone_apply();
+    }
+    else{ /* Nothing */ }
+}
+
+/* No sensor : the last reading is dropped and a pattern no warning zone uses is driven until a valid frame */
+static void application_failsafe_apply(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    link_distance = 0xFFFF;
+    retVal = ttc_estimator_reset(&application_ttc);
+    retVal = alert_zone_init(&application_zone);
+    application_zone_pending = 0;
+    retVal = soft_timer_stop(&alert_blink_timer);
+    retVal = soft_timer_stop(&buzzer_cadence_timer);
+    application_buzzer_output(0);
+    buzzer_tone_hz = 0;
+    retVal = soft_timer_set_period(&alert_blink_timer , APPLICATION_FAILSAFE_LED_PERIOD);
+    retVal = soft_timer_set_period(&buzzer_cadence_timer , APPLICATION_FAILSAFE_BUZZER_PERIOD);
+    led_turn_on(&led_1);
+    application_buzzer_output(1);
+    retVal = soft_timer_start(&alert_blink_timer);
+    retVal = soft_timer_start(&buzzer_cadence_timer);
+}
+
+static void application_zone_apply(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    const alert_zone_profile_t *l_profile = NULL;
+    retVal = soft_timer_stop(&alert_blink_timer);
+    retVal = soft_timer_stop(&buzzer_cadence_timer);
+    led_turn_off(&led_1);
+    application_buzzer_output(0);
+    retVal = alert_zone_get_profile(&application_zone , &l_profile);
+    if(E_OK == retVal){
+        if(0 != l_profile->led_period_ms){
+            retVal = soft_timer_set_period(&alert_blink_timer , l_profile->led_period_ms);
+            led_turn_on(&led_1);
+            retVal = soft_timer_start(&alert_blink_timer);
+        }
+        else{ /* Nothing */ }
+        if(0 != l_profile->buzzer_ms_per_cm){
+            buzzer_tone_hz = l_profile->tone_hz;
+            if(0 != buzzer_tone_hz){
+                retVal = CCP_PWM_Set_Frequency(&ccp1_pwm , buzzer_tone_hz);
+                retVal = CCP_PWM_Set_Duty(&ccp1_pwm , APPLICATION_BUZZER_TONE_DUTY);
+            }
+            else{ /* Nothing */ }
+            application_buzzer_output(1);
+            retVal = soft_timer_start(&buzzer_cadence_timer);
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
+}
+
+static void application_alert_blink(void){
+    led_toggle(&led_1);
+}
+
+static void application_buzzer_toggle(void){
+    application_buzzer_output((0 == buzzer_sounding) ? 1 : 0);
+}
+
+/* With a tone the CCP1 PWM drives the buzzer pin , stopping it gives the pin back to its latch (low) */
+static void application_buzzer_output(uint8 _sounding){
+    Std_ReturnType retVal = E_NOT_OK;
+    if(0 != buzzer_tone_hz){
+        if(1 == _sounding){
+            retVal = CCP_PWM_Start(&ccp1_pwm);
+        }
+        else{
+            retVal = CCP_PWM_Stop(&ccp1_pwm);
+            led_turn_off(&buzzer);
+        }
+    }
+    else if(1 == _sounding){
+        led_turn_on(&buzzer);
+    }
+    else{
+        led_turn_off(&buzzer);
+    }
+    buzzer_sounding = _sounding;
+}
+
+/* O(1) from the receive path : the running half-period completes, the new one starts at the next edge */
+static void application_buzzer_cadence_update(uint16 _distance){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint16 l_half_period_ms = 0;
+    retVal = alert_zone_get_buzzer_half_period(&application_zone , _distance , &l_half_period_ms);
+    if((E_OK == retVal) && (0 != l_half_period_ms)){
+        retVal = soft_timer_set_period(&buzzer_cadence_timer , l_half_period_ms);
+    }
+    else{ /* Nothing */ }
+}
+
+/* Closes the report window : the IDLE share is scaled by the measured window , not the nominal task period */
+static void application_report_task(void){
+    uint32 l_now_us = 0;
+    uint32 l_window_us = 0;
+    (void)time_now_us(&l_now_us);
+    l_window_us = l_now_us - application_window_start_us;
+    if(0 != l_window_us){
+        application_stats.idle_permille = (uint16)((application_idle_us * 1000UL) / l_window_us);
+    }
+    else{ /* Nothing */ }
+    application_stats.wakeups = application_wakeups;
+    if(0 != application_latency_count){
+        application_stats.wake_latency_avg_us = (uint16)(application_latency_sum_us / application_latency_count);
+    }
+    else{
+        application_stats.wake_latency_avg_us = 0;
+    }
+    application_stats.wake_latency_max_us = (application_latency_max_us > 0xFFFFUL) ? 0xFFFFU : (uint16)application_latency_max_us;
+    application_idle_us = 0;
+    application_wakeups = 0;
+    application_latency_sum_us = 0;
+    application_latency_max_us = 0;
+    application_latency_count = 0;
+    application_window_start_us = l_now_us;
+}
+
+/*
+ * Waits in the IDLE mode for the next interrupt. The checks and SLEEP run with the interrupts masked :
+ * an interrupt raised in between still wakes the core from its flag , it is serviced once they are
+ * restored , so no event is left waiting for the following wake up.
+ */
+static void application_idle(uint16 _last_ticks){
+    uint8 l_empty = 0;
+    uint16 l_ticks = 0;
+    uint32 l_sleep_us = 0;
+    uint32 l_wake_us = 0;
+    /* A wake up that posted nothing (Timer1 overflow , TX) has no handler to measure */
+    application_woken = 0;
+    INTERRUPT_GlobalInterruptHighDisable();
+    (void)event_queue_is_empty(&application_low_events , &l_empty);
+    (void)scheduler_get_ticks(&l_ticks);
+    if((1 == l_empty) && (l_ticks == _last_ticks)){
+        (void)time_now_us(&l_sleep_us);
+        SLEEP();
+        NOP();
+        (void)time_now_us(&l_wake_us);
+        application_idle_us += l_wake_us - l_sleep_us;
+        application_wakeups++;
+        application_wake_us = l_wake_us;
+        application_woken = 1;
+    }
+    else{ /* Nothing */ }
+    INTERRUPT_GlobalInterruptHighEnable();
+}
+
+/* Wake up to the first handler : the interrupt that woke the core plus the main loop path */
+static void application_wake_latency_record(void){
+    uint32 l_now_us = 0;
+    uint32 l_latency_us = 0;
+    if(1 == application_woken){
+        application_woken = 0;
+        (void)time_now_us(&l_now_us);
+        l_latency_us = l_now_us - application_wake_us;
+        application_latency_sum_us += l_latency_us;
+        application_latency_count++;
+        if(l_latency_us > application_latency_max_us){
+            application_latency_max_us = l_latency_us;
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
 }
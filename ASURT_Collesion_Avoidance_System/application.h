@@ -16,10 +16,42 @@
 
 /***********************************Macro Declarations**********************************/
 
+/* Events posted by the interrupt handlers and dispatched from the main loop */
+#define APPLICATION_EVENT_UART_RX           0x01U
+
+/* Task periods and first releases of the scheduler table (ms) */
+#define APPLICATION_ALERT_TASK_PERIOD       50U
+#define APPLICATION_ALERT_TASK_OFFSET       0U
+#define APPLICATION_LINK_TASK_PERIOD        500U        /* link_speed timeouts count these periods */
+#define APPLICATION_LINK_TASK_OFFSET        250U
+#define APPLICATION_REPORT_TASK_PERIOD      1000U       /* statistics window */
+#define APPLICATION_REPORT_TASK_OFFSET      125U
+
+/* The main loop waits in the IDLE mode when no event is queued and no tick is pending */
+#define APPLICATION_IDLE_MODE               CONFIG_ENABLE
+
+/* Period the alert timers are created with (ms) , replaced by the zone profile before they start */
+#define APPLICATION_ALERT_DEFAULT_PERIOD    500U
+/* Fail-safe pattern while the link is stale (ms) : fast LED blink , slow plain buzzer beep */
+#define APPLICATION_FAILSAFE_LED_PERIOD     100U
+#define APPLICATION_FAILSAFE_BUZZER_PERIOD  1000U
+/* Warnings also escalate on the predicted time-to-collision of the tracked obstacle */
+#define APPLICATION_TTC_MODE                CONFIG_ENABLE
+/* Duty cycle of the buzzer PWM tone (%) */
+#define APPLICATION_BUZZER_TONE_DUTY        50U
+
 /******************************Macro Function Declarations******************************/
 
 /***********************************Datatype Declarations*******************************/
 
+/* Figures of the last completed APPLICATION_REPORT_TASK_PERIOD window */
+typedef struct{
+    uint16 idle_permille;               /* main loop time spent in the IDLE mode */
+    uint16 wakeups;                     /* IDLE periods ended by an interrupt */
+    uint16 wake_latency_avg_us;         /* wake up to the first handler of the main loop */
+    uint16 wake_latency_max_us;
+}application_stats_t;
+
 /*********************************** ECU Externs *******************************/
 
 extern led_t led_1;
@@ -37,6 +69,8 @@ extern timer2_t timer;
 /***********************************Function Declarations*******************************/
 
 void application_initialize(void);
+void application_update_distance(const link_frame_t *frame , uint32 timestamp_us);
+void application_event_dispatch(const event_t *event);
 
 #endif	/* APPLICATION_H */
 
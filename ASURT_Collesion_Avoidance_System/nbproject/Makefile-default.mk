@@ -51,17 +51,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=ECU_Layer/LED/ecu_led.c ECU_Layer/ecu_layer_initialize.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EUSART/hal_eusart.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/device_config.c MCAL_Layer/mcal_layer_initialize.c application.c MCAL_Layer/Timer0/hal_timer0.c
+SOURCEFILES_QUOTED_IF_SPACED=ECU_Layer/LED/ecu_led.c ECU_Layer/ecu_layer_initialize.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EUSART/hal_eusart.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/device_config.c MCAL_Layer/mcal_layer_initialize.c application.c MCAL_Layer/Timer0/hal_timer0.c ECU_Layer/Link_Frame/ecu_link_frame.c ECU_Layer/Link_Speed/ecu_link_speed.c ECU_Layer/Event_Queue/ecu_event_queue.c ECU_Layer/Scheduler/ecu_scheduler.c ECU_Layer/Soft_Timer/ecu_soft_timer.c MCAL_Layer/Timer1/hal_timer1.c MCAL_Layer/Timer3/hal_timer3.c ECU_Layer/Alert_Zone/ecu_alert_zone.c ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c ECU_Layer/Link_Supervisor/ecu_link_supervisor.c ECU_Layer/Ultrasonic/ecu_ultrasonic.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 ${OBJECTDIR}/application.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1
-POSSIBLE_DEPFILES=${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1.d ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1.d ${OBJECTDIR}/application.p1.d ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 ${OBJECTDIR}/application.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1
+POSSIBLE_DEPFILES=${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1.d ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1.d ${OBJECTDIR}/application.p1.d ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 ${OBJECTDIR}/application.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1
+OBJECTFILES=${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 ${OBJECTDIR}/application.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1
 
 # Source Files
-SOURCEFILES=ECU_Layer/LED/ecu_led.c ECU_Layer/ecu_layer_initialize.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EUSART/hal_eusart.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/device_config.c MCAL_Layer/mcal_layer_initialize.c application.c MCAL_Layer/Timer0/hal_timer0.c
+SOURCEFILES=ECU_Layer/LED/ecu_led.c ECU_Layer/ecu_layer_initialize.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EUSART/hal_eusart.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/device_config.c MCAL_Layer/mcal_layer_initialize.c application.c MCAL_Layer/Timer0/hal_timer0.c ECU_Layer/Link_Frame/ecu_link_frame.c ECU_Layer/Link_Speed/ecu_link_speed.c ECU_Layer/Event_Queue/ecu_event_queue.c ECU_Layer/Scheduler/ecu_scheduler.c ECU_Layer/Soft_Timer/ecu_soft_timer.c MCAL_Layer/Timer1/hal_timer1.c MCAL_Layer/Timer3/hal_timer3.c ECU_Layer/Alert_Zone/ecu_alert_zone.c ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c ECU_Layer/Link_Supervisor/ecu_link_supervisor.c ECU_Layer/Ultrasonic/ecu_ultrasonic.c
 
 
 
@@ -200,6 +200,94 @@ ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1: MCAL_Layer/Timer0/hal_timer0.c  nb
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.d ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1: ECU_Layer/Link_Frame/ecu_link_frame.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Frame" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 ECU_Layer/Link_Frame/ecu_link_frame.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.d ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1: ECU_Layer/Link_Speed/ecu_link_speed.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Speed" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 ECU_Layer/Link_Speed/ecu_link_speed.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.d ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1: ECU_Layer/Event_Queue/ecu_event_queue.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Event_Queue" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 ECU_Layer/Event_Queue/ecu_event_queue.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.d ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1: ECU_Layer/Scheduler/ecu_scheduler.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Scheduler" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 ECU_Layer/Scheduler/ecu_scheduler.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.d ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1: ECU_Layer/Soft_Timer/ecu_soft_timer.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Soft_Timer" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 ECU_Layer/Soft_Timer/ecu_soft_timer.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.d ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1: MCAL_Layer/Timer1/hal_timer1.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer1" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 MCAL_Layer/Timer1/hal_timer1.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.d ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1: MCAL_Layer/Timer3/hal_timer3.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer3" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 MCAL_Layer/Timer3/hal_timer3.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.d ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1: ECU_Layer/Alert_Zone/ecu_alert_zone.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Alert_Zone" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 ECU_Layer/Alert_Zone/ecu_alert_zone.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.d ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1: ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/TTC_Estimator" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.d ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1: ECU_Layer/Link_Supervisor/ecu_link_supervisor.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Supervisor" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 ECU_Layer/Link_Supervisor/ecu_link_supervisor.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.d ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1: ECU_Layer/Ultrasonic/ecu_ultrasonic.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Ultrasonic" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 ECU_Layer/Ultrasonic/ecu_ultrasonic.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.d ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 else
 ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1: ECU_Layer/LED/ecu_led.c  nbproject/Makefile-${CND_CONF}.mk 
 	@${MKDIR} "${OBJECTDIR}/ECU_Layer/LED" 
@@ -313,6 +401,94 @@ ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1: MCAL_Layer/Timer0/hal_timer0.c  nb
 	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.d ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d 
 	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
 	
+${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1: ECU_Layer/Link_Frame/ecu_link_frame.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Frame" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 ECU_Layer/Link_Frame/ecu_link_frame.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.d ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1: ECU_Layer/Link_Speed/ecu_link_speed.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Speed" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 ECU_Layer/Link_Speed/ecu_link_speed.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.d ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1: ECU_Layer/Event_Queue/ecu_event_queue.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Event_Queue" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 ECU_Layer/Event_Queue/ecu_event_queue.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.d ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1: ECU_Layer/Scheduler/ecu_scheduler.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Scheduler" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 ECU_Layer/Scheduler/ecu_scheduler.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.d ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1: ECU_Layer/Soft_Timer/ecu_soft_timer.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Soft_Timer" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 ECU_Layer/Soft_Timer/ecu_soft_timer.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.d ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1: MCAL_Layer/Timer1/hal_timer1.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer1" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 MCAL_Layer/Timer1/hal_timer1.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.d ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1: MCAL_Layer/Timer3/hal_timer3.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer3" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 MCAL_Layer/Timer3/hal_timer3.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.d ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1: ECU_Layer/Alert_Zone/ecu_alert_zone.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Alert_Zone" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 ECU_Layer/Alert_Zone/ecu_alert_zone.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.d ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1: ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/TTC_Estimator" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.d ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1: ECU_Layer/Link_Supervisor/ecu_link_supervisor.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Supervisor" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 ECU_Layer/Link_Supervisor/ecu_link_supervisor.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.d ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1: ECU_Layer/Ultrasonic/ecu_ultrasonic.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Ultrasonic" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_default=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 ECU_Layer/Ultrasonic/ecu_ultrasonic.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.d ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
 endif
 
 # ------------------------------------------------------------------------------------
@@ -0,0 +1,542 @@
+#
+# Generated Makefile - do not edit!
+#
+# Edit the Makefile in the project folder instead (../Makefile). Each target
+# has a -pre and a -post target defined where you can add customized code.
+#
+# This makefile implements configuration specific macros and targets.
+
+
+# Include project Makefile
+ifeq "${IGNORE_LOCAL}" "TRUE"
+# do not include local makefile. User is passing all local related variables already
+else
+include Makefile
+# Include makefile containing local settings
+ifeq "$(wildcard nbproject/Makefile-local-sensor_node.mk)" "nbproject/Makefile-local-sensor_node.mk"
+include nbproject/Makefile-local-sensor_node.mk
+endif
+endif
+
+# Environment
+MKDIR=gnumkdir -p
+RM=rm -f 
+MV=mv 
+CP=cp 
+
+# Macros
+CND_CONF=sensor_node
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+IMAGE_TYPE=debug
+OUTPUT_SUFFIX=elf
+DEBUGGABLE_SUFFIX=elf
+FINAL_IMAGE=${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.${OUTPUT_SUFFIX}
+else
+IMAGE_TYPE=production
+OUTPUT_SUFFIX=hex
+DEBUGGABLE_SUFFIX=elf
+FINAL_IMAGE=${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.${OUTPUT_SUFFIX}
+endif
+
+ifeq ($(COMPARE_BUILD), true)
+COMPARISON_BUILD=-mafrlcsj
+else
+COMPARISON_BUILD=
+endif
+
+# Object Directory
+OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
+
+# Distribution Directory
+DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
+
+# Source Files Quoted if spaced
+SOURCEFILES_QUOTED_IF_SPACED=ECU_Layer/LED/ecu_led.c ECU_Layer/ecu_layer_initialize.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EUSART/hal_eusart.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/device_config.c MCAL_Layer/mcal_layer_initialize.c sensor_node.c MCAL_Layer/Timer0/hal_timer0.c ECU_Layer/Link_Frame/ecu_link_frame.c ECU_Layer/Link_Speed/ecu_link_speed.c ECU_Layer/Event_Queue/ecu_event_queue.c ECU_Layer/Scheduler/ecu_scheduler.c ECU_Layer/Soft_Timer/ecu_soft_timer.c MCAL_Layer/Timer1/hal_timer1.c MCAL_Layer/Timer3/hal_timer3.c ECU_Layer/Alert_Zone/ecu_alert_zone.c ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c ECU_Layer/Link_Supervisor/ecu_link_supervisor.c ECU_Layer/Ultrasonic/ecu_ultrasonic.c
+
+# Object Files Quoted if spaced
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 ${OBJECTDIR}/sensor_node.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1
+POSSIBLE_DEPFILES=${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1.d ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1.d ${OBJECTDIR}/sensor_node.p1.d ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d
+
+# Object Files
+OBJECTFILES=${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 ${OBJECTDIR}/MCAL_Layer/device_config.p1 ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 ${OBJECTDIR}/sensor_node.p1 ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1
+
+# Source Files
+SOURCEFILES=ECU_Layer/LED/ecu_led.c ECU_Layer/ecu_layer_initialize.c MCAL_Layer/ADC/hal_adc.c MCAL_Layer/CCP/hal_ccp.c MCAL_Layer/EUSART/hal_eusart.c MCAL_Layer/GPIO/hal_gpio.c MCAL_Layer/Interrupt/mcal_internal_interrupt.c MCAL_Layer/Interrupt/mcal_external_interrupt.c MCAL_Layer/Interrupt/mcal_interrupt_manager.c MCAL_Layer/Timer2/hal_timer2.c MCAL_Layer/device_config.c MCAL_Layer/mcal_layer_initialize.c sensor_node.c MCAL_Layer/Timer0/hal_timer0.c ECU_Layer/Link_Frame/ecu_link_frame.c ECU_Layer/Link_Speed/ecu_link_speed.c ECU_Layer/Event_Queue/ecu_event_queue.c ECU_Layer/Scheduler/ecu_scheduler.c ECU_Layer/Soft_Timer/ecu_soft_timer.c MCAL_Layer/Timer1/hal_timer1.c MCAL_Layer/Timer3/hal_timer3.c ECU_Layer/Alert_Zone/ecu_alert_zone.c ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c ECU_Layer/Link_Supervisor/ecu_link_supervisor.c ECU_Layer/Ultrasonic/ecu_ultrasonic.c
+
+
+
+CFLAGS=
+ASFLAGS=
+LDLIBSOPTIONS=
+
+############# Tool locations ##########################################
+# If you copy a project from one host to another, the path where the  #
+# compiler is installed may be different.                             #
+# If you open this project with MPLAB X in the new host, this         #
+# makefile will be regenerated and the paths will be corrected.       #
+#######################################################################
+# fixDeps replaces a bunch of sed/cat/printf statements that slow down the build
+FIXDEPS=fixDeps
+
+.build-conf:  ${BUILD_SUBPROJECTS}
+ifneq ($(INFORMATION_MESSAGE), )
+	@echo $(INFORMATION_MESSAGE)
+endif
+	${MAKE}  -f nbproject/Makefile-sensor_node.mk ${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.${OUTPUT_SUFFIX}
+
+MP_PROCESSOR_OPTION=18F4620
+# ------------------------------------------------------------------------------------
+# Rules for buildStep: compile
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1: ECU_Layer/LED/ecu_led.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/LED" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ECU_Layer/LED/ecu_led.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/LED/ecu_led.d ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1: ECU_Layer/ecu_layer_initialize.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 ECU_Layer/ecu_layer_initialize.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.d ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1: MCAL_Layer/ADC/hal_adc.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 MCAL_Layer/ADC/hal_adc.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1: MCAL_Layer/CCP/hal_ccp.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/CCP" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 MCAL_Layer/CCP/hal_ccp.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.d ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1: MCAL_Layer/EUSART/hal_eusart.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/EUSART" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 MCAL_Layer/EUSART/hal_eusart.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.d ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1: MCAL_Layer/GPIO/hal_gpio.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/GPIO" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 MCAL_Layer/GPIO/hal_gpio.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.d ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1: MCAL_Layer/Interrupt/mcal_internal_interrupt.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Interrupt" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 MCAL_Layer/Interrupt/mcal_internal_interrupt.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1: MCAL_Layer/Interrupt/mcal_external_interrupt.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Interrupt" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 MCAL_Layer/Interrupt/mcal_external_interrupt.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1: MCAL_Layer/Interrupt/mcal_interrupt_manager.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Interrupt" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 MCAL_Layer/Interrupt/mcal_interrupt_manager.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1: MCAL_Layer/Timer2/hal_timer2.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer2" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 MCAL_Layer/Timer2/hal_timer2.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.d ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/device_config.p1: MCAL_Layer/device_config.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/device_config.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/device_config.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/device_config.p1 MCAL_Layer/device_config.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/device_config.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/device_config.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1: MCAL_Layer/mcal_layer_initialize.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 MCAL_Layer/mcal_layer_initialize.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.d ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/sensor_node.p1: sensor_node.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/sensor_node.p1.d 
+	@${RM} ${OBJECTDIR}/sensor_node.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/sensor_node.p1 sensor_node.c 
+	@-${MV} ${OBJECTDIR}/application.d ${OBJECTDIR}/sensor_node.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/sensor_node.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1: MCAL_Layer/Timer0/hal_timer0.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer0" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 MCAL_Layer/Timer0/hal_timer0.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.d ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1: ECU_Layer/Link_Frame/ecu_link_frame.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Frame" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 ECU_Layer/Link_Frame/ecu_link_frame.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.d ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1: ECU_Layer/Link_Speed/ecu_link_speed.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Speed" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 ECU_Layer/Link_Speed/ecu_link_speed.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.d ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1: ECU_Layer/Event_Queue/ecu_event_queue.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Event_Queue" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 ECU_Layer/Event_Queue/ecu_event_queue.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.d ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1: ECU_Layer/Scheduler/ecu_scheduler.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Scheduler" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 ECU_Layer/Scheduler/ecu_scheduler.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.d ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1: ECU_Layer/Soft_Timer/ecu_soft_timer.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Soft_Timer" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 ECU_Layer/Soft_Timer/ecu_soft_timer.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.d ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1: MCAL_Layer/Timer1/hal_timer1.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer1" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 MCAL_Layer/Timer1/hal_timer1.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.d ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1: MCAL_Layer/Timer3/hal_timer3.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer3" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 MCAL_Layer/Timer3/hal_timer3.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.d ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1: ECU_Layer/Alert_Zone/ecu_alert_zone.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Alert_Zone" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 ECU_Layer/Alert_Zone/ecu_alert_zone.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.d ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1: ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/TTC_Estimator" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.d ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1: ECU_Layer/Link_Supervisor/ecu_link_supervisor.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Supervisor" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 ECU_Layer/Link_Supervisor/ecu_link_supervisor.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.d ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1: ECU_Layer/Ultrasonic/ecu_ultrasonic.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Ultrasonic" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c  -D__DEBUG=1  -mdebugger=none   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 ECU_Layer/Ultrasonic/ecu_ultrasonic.c 
+	@-${MV} ${OBJECTDIR}/application.d ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+else
+${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1: ECU_Layer/LED/ecu_led.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/LED" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1 ECU_Layer/LED/ecu_led.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/LED/ecu_led.d ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/LED/ecu_led.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1: ECU_Layer/ecu_layer_initialize.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1 ECU_Layer/ecu_layer_initialize.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.d ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/ecu_layer_initialize.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1: MCAL_Layer/ADC/hal_adc.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/ADC" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1 MCAL_Layer/ADC/hal_adc.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.d ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/ADC/hal_adc.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1: MCAL_Layer/CCP/hal_ccp.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/CCP" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1 MCAL_Layer/CCP/hal_ccp.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.d ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/CCP/hal_ccp.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1: MCAL_Layer/EUSART/hal_eusart.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/EUSART" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1 MCAL_Layer/EUSART/hal_eusart.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.d ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/EUSART/hal_eusart.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1: MCAL_Layer/GPIO/hal_gpio.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/GPIO" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1 MCAL_Layer/GPIO/hal_gpio.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.d ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/GPIO/hal_gpio.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1: MCAL_Layer/Interrupt/mcal_internal_interrupt.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Interrupt" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1 MCAL_Layer/Interrupt/mcal_internal_interrupt.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_internal_interrupt.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1: MCAL_Layer/Interrupt/mcal_external_interrupt.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Interrupt" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1 MCAL_Layer/Interrupt/mcal_external_interrupt.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_external_interrupt.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1: MCAL_Layer/Interrupt/mcal_interrupt_manager.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Interrupt" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1 MCAL_Layer/Interrupt/mcal_interrupt_manager.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.d ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Interrupt/mcal_interrupt_manager.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1: MCAL_Layer/Timer2/hal_timer2.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer2" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1 MCAL_Layer/Timer2/hal_timer2.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.d ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer2/hal_timer2.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/device_config.p1: MCAL_Layer/device_config.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/device_config.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/device_config.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/device_config.p1 MCAL_Layer/device_config.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/device_config.d ${OBJECTDIR}/MCAL_Layer/device_config.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/device_config.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1: MCAL_Layer/mcal_layer_initialize.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1 MCAL_Layer/mcal_layer_initialize.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.d ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/mcal_layer_initialize.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/sensor_node.p1: sensor_node.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}" 
+	@${RM} ${OBJECTDIR}/sensor_node.p1.d 
+	@${RM} ${OBJECTDIR}/sensor_node.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/sensor_node.p1 sensor_node.c 
+	@-${MV} ${OBJECTDIR}/application.d ${OBJECTDIR}/sensor_node.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/sensor_node.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1: MCAL_Layer/Timer0/hal_timer0.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer0" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1 MCAL_Layer/Timer0/hal_timer0.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.d ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer0/hal_timer0.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1: ECU_Layer/Link_Frame/ecu_link_frame.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Frame" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1 ECU_Layer/Link_Frame/ecu_link_frame.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.d ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Frame/ecu_link_frame.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1: ECU_Layer/Link_Speed/ecu_link_speed.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Speed" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1 ECU_Layer/Link_Speed/ecu_link_speed.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.d ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Speed/ecu_link_speed.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1: ECU_Layer/Event_Queue/ecu_event_queue.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Event_Queue" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1 ECU_Layer/Event_Queue/ecu_event_queue.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.d ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Event_Queue/ecu_event_queue.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1: ECU_Layer/Scheduler/ecu_scheduler.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Scheduler" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1 ECU_Layer/Scheduler/ecu_scheduler.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.d ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Scheduler/ecu_scheduler.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1: ECU_Layer/Soft_Timer/ecu_soft_timer.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Soft_Timer" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1 ECU_Layer/Soft_Timer/ecu_soft_timer.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.d ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Soft_Timer/ecu_soft_timer.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1: MCAL_Layer/Timer1/hal_timer1.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer1" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1 MCAL_Layer/Timer1/hal_timer1.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.d ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer1/hal_timer1.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1: MCAL_Layer/Timer3/hal_timer3.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/MCAL_Layer/Timer3" 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d 
+	@${RM} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1 MCAL_Layer/Timer3/hal_timer3.c 
+	@-${MV} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.d ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/MCAL_Layer/Timer3/hal_timer3.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1: ECU_Layer/Alert_Zone/ecu_alert_zone.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Alert_Zone" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1 ECU_Layer/Alert_Zone/ecu_alert_zone.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.d ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Alert_Zone/ecu_alert_zone.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1: ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/TTC_Estimator" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1 ECU_Layer/TTC_Estimator/ecu_ttc_estimator.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.d ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/TTC_Estimator/ecu_ttc_estimator.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1: ECU_Layer/Link_Supervisor/ecu_link_supervisor.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Link_Supervisor" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1 ECU_Layer/Link_Supervisor/ecu_link_supervisor.c 
+	@-${MV} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.d ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Link_Supervisor/ecu_link_supervisor.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1: ECU_Layer/Ultrasonic/ecu_ultrasonic.c  nbproject/Makefile-${CND_CONF}.mk 
+	@${MKDIR} "${OBJECTDIR}/ECU_Layer/Ultrasonic" 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${RM} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 
+	${MP_CC} $(MP_EXTRA_CC_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -c   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -DXPRJ_sensor_node=$(CND_CONF)  -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits $(COMPARISON_BUILD)  -std=c99 -gcoff -mstack=compiled:auto:auto:auto     -o ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1 ECU_Layer/Ultrasonic/ecu_ultrasonic.c 
+	@-${MV} ${OBJECTDIR}/application.d ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d 
+	@${FIXDEPS} ${OBJECTDIR}/ECU_Layer/Ultrasonic/ecu_ultrasonic.p1.d $(SILENT) -rsi ${MP_CC_DIR}../  
+	
+endif
+
+# ------------------------------------------------------------------------------------
+# Rules for buildStep: assemble
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+else
+endif
+
+# ------------------------------------------------------------------------------------
+# Rules for buildStep: assembleWithPreprocess
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+else
+endif
+
+# ------------------------------------------------------------------------------------
+# Rules for buildStep: link
+ifeq ($(TYPE_IMAGE), DEBUG_RUN)
+${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.${OUTPUT_SUFFIX}: ${OBJECTFILES}  nbproject/Makefile-${CND_CONF}.mk    
+	@${MKDIR} ${DISTDIR} 
+	${MP_CC} $(MP_EXTRA_LD_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -Wl,-Map=${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.map  -D__DEBUG=1  -mdebugger=none  -DXPRJ_sensor_node=$(CND_CONF)  -Wl,--defsym=__MPLAB_BUILD=1   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits -std=c99 -gcoff -mstack=compiled:auto:auto:auto        $(COMPARISON_BUILD) -Wl,--memorysummary,${DISTDIR}/memoryfile.xml -o ${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.${DEBUGGABLE_SUFFIX}  ${OBJECTFILES_QUOTED_IF_SPACED}     
+	@${RM} ${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.hex 
+	
+	
+else
+${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.${OUTPUT_SUFFIX}: ${OBJECTFILES}  nbproject/Makefile-${CND_CONF}.mk   
+	@${MKDIR} ${DISTDIR} 
+	${MP_CC} $(MP_EXTRA_LD_PRE) -mcpu=$(MP_PROCESSOR_OPTION) -Wl,-Map=${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.map  -DXPRJ_sensor_node=$(CND_CONF)  -Wl,--defsym=__MPLAB_BUILD=1   -mdfp="${DFP_DIR}/xc8"  -fno-short-double -fno-short-float -memi=wordwrite -O0 -fasmfile -maddrqual=ignore -DSENSOR_NODE_BUILD -xassembler-with-cpp -mwarn=-3 -Wa,-a -msummary=-psect,-class,+mem,-hex,-file  -ginhx32 -Wl,--data-init -mno-keep-startup -mno-download -mno-default-config-bits -std=c99 -gcoff -mstack=compiled:auto:auto:auto     $(COMPARISON_BUILD) -Wl,--memorysummary,${DISTDIR}/memoryfile.xml -o ${DISTDIR}/ASURT_Collesion_Avoidance_System.${IMAGE_TYPE}.${DEBUGGABLE_SUFFIX}  ${OBJECTFILES_QUOTED_IF_SPACED}     
+	
+	
+endif
+
+
+# Subprojects
+.build-subprojects:
+
+
+# Subprojects
+.clean-subprojects:
+
+# Clean Targets
+.clean-conf: ${CLEAN_SUBPROJECTS}
+	${RM} -r ${OBJECTDIR}
+	${RM} -r ${DISTDIR}
+
+# Enable dependency checking
+.dep.inc: .depcheck-impl
+
+DEPFILES=$(wildcard ${POSSIBLE_DEPFILES})
+ifneq (${DEPFILES},)
+include ${DEPFILES}
+endif
@@ -8,3 +8,7 @@ CND_BASEDIR=`pwd`
 CND_ARTIFACT_DIR_default=dist/default/production
 CND_ARTIFACT_NAME_default=ASURT_Collesion_Avoidance_System.production.hex
 CND_ARTIFACT_PATH_default=dist/default/production/ASURT_Collesion_Avoidance_System.production.hex
+# sensor_node configuration
+CND_ARTIFACT_DIR_sensor_node=dist/sensor_node/production
+CND_ARTIFACT_NAME_sensor_node=ASURT_Collesion_Avoidance_System.production.hex
+CND_ARTIFACT_PATH_sensor_node=dist/sensor_node/production/ASURT_Collesion_Avoidance_System.production.hex
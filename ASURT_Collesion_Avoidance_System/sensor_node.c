@@ -0,0 +1,281 @@
+/*
+ * File:   sensor_node.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 05:30 PM
+ */
+
+#include "sensor_node.h"
+
+/* Main entry of the sensor node (PIC 2) image , built by the sensor_node configuration instead of application.c */
+
+/* Statistics of the last report window , watched from the debugger */
+sensor_node_stats_t sensor_node_stats;
+static uint8 uart_rx_bytes[EUSART_RX_BUFFER_SIZE];
+static link_frame_parser_t link_parser;
+static link_speed_t link_speed;
+/* Producers : the ADC , ranger and EUSART RX interrupts , all on the low priority level */
+static event_queue_t sensor_node_events;
+/* Set while an UART RX event is queued, one event drains every byte buffered so far */
+static volatile uint8 uart_rx_event_pending = 0;
+/* Timer0 ticks since the last conversion was started , only touched by the Timer0 interrupt */
+static uint8 sensor_node_sample_divider = 0;
+/* Single byte so the main loop reads it atomically , wraps around */
+static volatile uint8 sensor_node_sample_overruns = 0;
+static uint8 sensor_node_sample_overruns_seen = 0;
+/* Filtered samples (ADC counts or cm) with SENSOR_NODE_FILTER_FRACTION_BITS fraction bits */
+static uint32 sensor_node_filter = 0;
+static uint8 sensor_node_filter_valid = 0;
+/* Set by a timed out measurement , frames carry LINK_FRAME_FLAG_NO_ECHO until the next echo */
+static uint8 sensor_node_no_echo = 0;
+/* Report window : main loop busy time and the counts it turns into rates */
+static uint32 sensor_node_busy_us = 0;
+static uint32 sensor_node_window_start_us = 0;
+static uint16 sensor_node_window_samples = 0;
+static uint16 sensor_node_window_frames = 0;
+
+static void sensor_node_sample_process(uint16 _sample);
+static void sensor_node_range_process(uint16 _distance_cm);
+static void sensor_node_range_callback(uint16 _distance_cm);
+static void sensor_node_uart_rx_process(void);
+static void sensor_node_send_task(void);
+static void sensor_node_link_task(void);
+static void sensor_node_report_task(void);
+
+#if SENSOR_NODE_SOURCE == SENSOR_NODE_SOURCE_ULTRASONIC
+static ultrasonic_t sensor_node_ranger = {
+    .trigger_pin.port = PORTD_INDEX,
+    .trigger_pin.pin = GPIO_PIN1,
+    .trigger_pin.direction = GPIO_DIRECTION_OUTPUT,
+    .trigger_pin.logic = GPIO_LOW,
+    .echo_ccp = &ccp2_capture,
+    .timer = &timer3_obj,
+    .reading_callback = sensor_node_range_callback
+};
+#endif
+
+/* Cooperative tasks released by the 1 ms Timer0 tick, run to completion from the main loop */
+static const scheduler_task_t sensor_node_tasks[] = {
+    {sensor_node_send_task   , SENSOR_NODE_SEND_TASK_PERIOD   , SENSOR_NODE_SEND_TASK_OFFSET},
+    {sensor_node_link_task   , SENSOR_NODE_LINK_TASK_PERIOD   , SENSOR_NODE_LINK_TASK_OFFSET},
+    {sensor_node_report_task , SENSOR_NODE_REPORT_TASK_PERIOD , SENSOR_NODE_REPORT_TASK_OFFSET}
+};
+
+int main() {
+    event_t event;
+    uint16 ticks = 0;
+    uint16 last_ticks = 0;
+    uint8 busy = 0;
+    uint32 busy_start_us = 0;
+    uint32 busy_end_us = 0;
+    sensor_node_initialize();
+
+    while(1){
+        busy = 0;
+        (void)time_now_us(&busy_start_us);
+        /* Bottom half of the interrupts : the ISRs only post events , the handlers run here */
+        while(E_OK == event_queue_get(&sensor_node_events , &event)){
+            sensor_node_event_dispatch(&event);
+            busy = 1;
+        }
+        /* Tasks are only released on a tick , an unchanged tick leaves nothing to dispatch */
+        if((E_OK == scheduler_get_ticks(&ticks)) && (ticks != last_ticks)){
+            last_ticks = ticks;
+            (void)scheduler_dispatch();
+            busy = 1;
+        }
+        else{ /* Nothing */ }
+        /* The load counts the iterations that ran a handler , an idle iteration only polls */
+        if(1 == busy){
+            (void)time_now_us(&busy_end_us);
+            sensor_node_busy_us += busy_end_us - busy_start_us;
+        }
+        else{ /* Nothing */ }
+    }
+
+    return (EXIT_SUCCESS);
+}
+
+void Timer0_DefaultInterruptHandler(void){
+    scheduler_tick();
+    sensor_node_sample_divider++;
+    if(sensor_node_sample_divider >= SENSOR_NODE_SAMPLE_PERIOD){
+        sensor_node_sample_divider = 0;
+#if SENSOR_NODE_SOURCE == SENSOR_NODE_SOURCE_ULTRASONIC
+        /* Refused while the previous measurement is still waiting for its echo */
+        if(E_OK != ultrasonic_trigger(&sensor_node_ranger)){
+            sensor_node_sample_overruns++;
+        }
+        else{ /* Nothing */ }
+#else
+        /* GO/DONE clear : the previous conversion completed */
+        if(0 == ADC_CONVERSION_STATUS()){
+            (void)ADC_Start_Conversion(&adc_1);
+        }
+        else{
+            sensor_node_sample_overruns++;
+        }
+#endif
+    }
+    else{ /* Nothing */ }
+}
+
+void ADC_DefaultInterruptHandler(void){
+    uint16 l_result = 0;
+    (void)ADC_Get_Conversion_Result(&adc_1 , &l_result);
+    (void)event_queue_post(&sensor_node_events , SENSOR_NODE_EVENT_ADC , l_result);
+}
+
+void CCP2_DefaultInterruptHandler(void){
+    ultrasonic_capture_isr();
+}
+
+void Timer3_DefaultInterruptHandler(void){
+    ultrasonic_timer_isr();
+}
+
+void EUSART_RxDefaultInterruptHandler(void){
+    if(0 == uart_rx_event_pending){
+        uart_rx_event_pending = 1;
+        (void)event_queue_post(&sensor_node_events , SENSOR_NODE_EVENT_UART_RX , 0);
+    }
+    else{ /* Nothing */ }
+}
+
+void sensor_node_initialize(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    ecu_layer_initialize();
+    mcal_layer_initialize();
+    retVal = event_queue_init(&sensor_node_events);
+    retVal = link_frame_parser_init(&link_parser);
+    /* The sensor node offers the auto-baud character and asks the receiver for faster rates */
+    retVal = link_speed_init(&link_speed , &eusart_1 , &link_parser , LINK_SPEED_INITIATOR);
+#if SENSOR_NODE_SOURCE == SENSOR_NODE_SOURCE_ULTRASONIC
+    /* After the MCAL layer : stops the capture and Timer3 left running by their initialization */
+    retVal = ultrasonic_init(&sensor_node_ranger);
+#endif
+    retVal = scheduler_init(&timer0_obj , sensor_node_tasks , (uint8)(sizeof(sensor_node_tasks) / sizeof(sensor_node_tasks[0])));
+    retVal = time_now_us(&sensor_node_window_start_us);
+}
+
+void sensor_node_event_dispatch(const event_t *event){
+    switch(event->id){
+        case SENSOR_NODE_EVENT_ADC :
+            sensor_node_sample_process(event->data);
+            break;
+        case SENSOR_NODE_EVENT_RANGE :
+            sensor_node_range_process(event->data);
+            break;
+        case SENSOR_NODE_EVENT_UART_RX :
+            sensor_node_uart_rx_process();
+            break;
+        default :
+            break;
+    }
+}
+
+/* Integer EMA , stepped in unsigned arithmetic on both sides so no negative value is shifted */
+static void sensor_node_sample_process(uint16 _sample){
+    uint32 l_target = (uint32)_sample << SENSOR_NODE_FILTER_FRACTION_BITS;
+    if(0 == sensor_node_filter_valid){
+        sensor_node_filter = l_target;
+        sensor_node_filter_valid = 1;
+    }
+    else if(l_target >= sensor_node_filter){
+        sensor_node_filter += (l_target - sensor_node_filter) >> SENSOR_NODE_FILTER_SHIFT;
+    }
+    else{
+        sensor_node_filter -= (sensor_node_filter - l_target) >> SENSOR_NODE_FILTER_SHIFT;
+    }
+    sensor_node_window_samples++;
+}
+
+/* A timed out measurement restarts the filter , the next echo seeds it again */
+static void sensor_node_range_process(uint16 _distance_cm){
+    if(ULTRASONIC_NO_ECHO == _distance_cm){
+        sensor_node_filter_valid = 0;
+        sensor_node_no_echo = 1;
+        sensor_node_stats.no_echo++;
+        sensor_node_window_samples++;
+    }
+    else{
+        sensor_node_no_echo = 0;
+        sensor_node_sample_process(_distance_cm);
+    }
+}
+
+/* Called from the CCP2 or Timer3 interrupt , the reading is handled from the main loop */
+static void sensor_node_range_callback(uint16 _distance_cm){
+    (void)event_queue_post(&sensor_node_events , SENSOR_NODE_EVENT_RANGE , _distance_cm);
+}
+
+/* Only control frames come back from the receiver , they drive the link speed negotiation */
+static void sensor_node_uart_rx_process(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint8 rx_length = 0;
+    uint8 rx_index = 0;
+    uint8 frame_ready = 0;
+    uint8 frame_consumed = 0;
+    link_frame_t rx_frame;
+    /* Cleared before draining so a byte buffered from now on posts a new event */
+    uart_rx_event_pending = 0;
+    retVal = EUSART_ASYNC_Read_Buffer(&eusart_1 , uart_rx_bytes , EUSART_RX_BUFFER_SIZE , &rx_length);
+    if(E_OK != retVal){
+        rx_length = 0;
+    }
+    for(rx_index = 0 ; rx_index < rx_length ; rx_index++){
+        retVal = link_frame_parser_feed(&link_parser , uart_rx_bytes[rx_index] , &rx_frame , &frame_ready);
+        if(1 == frame_ready){
+            retVal = link_speed_frame_received(&link_speed , &rx_frame , &frame_consumed);
+        }
+    }
+}
+
+/* Paced transmission : one frame per period carrying the latest filtered distance */
+static void sensor_node_send_task(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    uint16 l_distance = 0;
+    if(1 == sensor_node_no_echo){
+        retVal = link_speed_send_data(&link_speed , ULTRASONIC_NO_ECHO , LINK_FRAME_FLAG_NO_ECHO);
+    }
+    else if(1 == sensor_node_filter_valid){
+        l_distance = (uint16)(((sensor_node_filter * SENSOR_NODE_CM_PER_COUNT_NUM) +
+                               ((SENSOR_NODE_CM_PER_COUNT_DEN << SENSOR_NODE_FILTER_FRACTION_BITS) / 2UL)) /
+                              (SENSOR_NODE_CM_PER_COUNT_DEN << SENSOR_NODE_FILTER_FRACTION_BITS));
+        retVal = link_speed_send_data(&link_speed , l_distance , 0);
+    }
+    else{ /* Nothing */ }
+    if(E_OK == retVal){
+        sensor_node_window_frames++;
+    }
+    else{
+        sensor_node_stats.frames_skipped++;
+    }
+}
+
+static void sensor_node_link_task(void){
+    Std_ReturnType retVal = E_NOT_OK;
+    retVal = link_speed_periodic(&link_speed);
+}
+
+/* Closes the report window : rates are scaled by the measured window , not the nominal task period */
+static void sensor_node_report_task(void){
+    uint32 l_now_us = 0;
+    uint32 l_window_us = 0;
+    uint8 l_overruns = 0;
+    (void)time_now_us(&l_now_us);
+    l_window_us = l_now_us - sensor_node_window_start_us;
+    if(0 != l_window_us){
+        sensor_node_stats.load_permille = (uint16)((sensor_node_busy_us * 1000UL) / l_window_us);
+        sensor_node_stats.sample_rate_hz = (uint16)((((uint32)sensor_node_window_samples * 1000000UL) + (l_window_us / 2UL)) / l_window_us);
+        sensor_node_stats.send_rate_hz = (uint16)((((uint32)sensor_node_window_frames * 1000000UL) + (l_window_us / 2UL)) / l_window_us);
+    }
+    else{ /* Nothing */ }
+    l_overruns = sensor_node_sample_overruns;
+    sensor_node_stats.sample_overruns += (uint8)(l_overruns - sensor_node_sample_overruns_seen);
+    sensor_node_sample_overruns_seen = l_overruns;
+    sensor_node_busy_us = 0;
+    sensor_node_window_samples = 0;
+    sensor_node_window_frames = 0;
+    sensor_node_window_start_us = l_now_us;
+}
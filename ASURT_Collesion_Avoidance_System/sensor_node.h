@@ -0,0 +1,94 @@
+/*
+ * File:   sensor_node.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 05:30 PM
+ */
+
+#ifndef SENSOR_NODE_H
+#define	SENSOR_NODE_H
+
+/***************************************Includes***************************************/
+
+#include "ECU_Layer/ecu_layer_initialize.h"
+#include "MCAL_Layer/mcal_layer_initialize.h"
+
+/***********************************Macro Declarations**********************************/
+
+/* Events posted by the interrupt handlers and dispatched from the main loop */
+#define SENSOR_NODE_EVENT_ADC               0x01U
+#define SENSOR_NODE_EVENT_UART_RX           0x02U
+#define SENSOR_NODE_EVENT_RANGE             0x03U
+
+/* Distance source of the sensor node */
+#define SENSOR_NODE_SOURCE_ANALOG           0x00U       /* analog output sensor on AN0 */
+#define SENSOR_NODE_SOURCE_ULTRASONIC       0x01U       /* trigger on RD1 , echo captured by CCP2 on RC1 */
+
+#define SENSOR_NODE_SOURCE                  SENSOR_NODE_SOURCE_ULTRASONIC
+
+#if SENSOR_NODE_SOURCE == SENSOR_NODE_SOURCE_ULTRASONIC
+/* One measurement is triggered every SENSOR_NODE_SAMPLE_PERIOD Timer0 ticks (ms) , longer than the echo timeout */
+#define SENSOR_NODE_SAMPLE_PERIOD           30U
+#else
+/* One AN0 conversion is started every SENSOR_NODE_SAMPLE_PERIOD Timer0 ticks (ms) */
+#define SENSOR_NODE_SAMPLE_PERIOD           10U
+#endif
+
+/* Exponential moving average : a new sample weighs 1 / 2^SHIFT , the state keeps FRACTION_BITS below the ADC LSB */
+#define SENSOR_NODE_FILTER_SHIFT            2U
+#define SENSOR_NODE_FILTER_FRACTION_BITS    4U
+
+#if SENSOR_NODE_SOURCE == SENSOR_NODE_SOURCE_ULTRASONIC
+/* The ranger already reports centimeters */
+#define SENSOR_NODE_CM_PER_COUNT_NUM        1UL
+#define SENSOR_NODE_CM_PER_COUNT_DEN        1UL
+#else
+/* Filtered ADC counts to distance (cm) : the 4.88 mV per count / 10 scaling of the original sensor code */
+#define SENSOR_NODE_CM_PER_COUNT_NUM        488UL
+#define SENSOR_NODE_CM_PER_COUNT_DEN        1000UL
+#endif
+
+/* Task periods and first releases of the scheduler table (ms) */
+#define SENSOR_NODE_SEND_TASK_PERIOD        50U         /* one distance frame per period */
+#define SENSOR_NODE_SEND_TASK_OFFSET        5U
+#define SENSOR_NODE_LINK_TASK_PERIOD        500U        /* link_speed timeouts count these periods */
+#define SENSOR_NODE_LINK_TASK_OFFSET        250U
+#define SENSOR_NODE_REPORT_TASK_PERIOD      1000U       /* statistics window */
+#define SENSOR_NODE_REPORT_TASK_OFFSET      0U
+
+#if (0U == SENSOR_NODE_SAMPLE_PERIOD) || (SENSOR_NODE_SAMPLE_PERIOD > SENSOR_NODE_SEND_TASK_PERIOD)
+#error "SENSOR_NODE_SAMPLE_PERIOD must give at least one sample per send period"
+#endif
+
+#if (SENSOR_NODE_SOURCE == SENSOR_NODE_SOURCE_ULTRASONIC) && ((SENSOR_NODE_SAMPLE_PERIOD * 1000UL) <= ULTRASONIC_ECHO_TIMEOUT_US)
+#error "SENSOR_NODE_SAMPLE_PERIOD must be longer than the ultrasonic echo timeout"
+#endif
+
+/******************************Macro Function Declarations******************************/
+
+/***********************************Datatype Declarations*******************************/
+
+/* Figures of the last completed SENSOR_NODE_REPORT_TASK_PERIOD window , the counters are cumulative */
+typedef struct{
+    uint16 load_permille;               /* main loop time spent in event handlers and tasks */
+    uint16 sample_rate_hz;              /* conversions filtered per second */
+    uint16 send_rate_hz;                /* distance frames accepted by the transmit queue per second */
+    uint16 frames_skipped;              /* send periods without a frame : no sample yet , link not synchronized or queue full */
+    uint16 sample_overruns;             /* sample periods skipped because the previous conversion or measurement was still running */
+    uint16 no_echo;                     /* ultrasonic measurements that timed out */
+}sensor_node_stats_t;
+
+/*********************************** MCAL Externs *******************************/
+
+extern eusart_t eusart_1;
+extern adc_config_t adc_1;
+extern timer0_t timer0_obj;
+extern ccp_t ccp2_capture;
+extern timer3_t timer3_obj;
+
+/***********************************Function Declarations*******************************/
+
+void sensor_node_initialize(void);
+void sensor_node_event_dispatch(const event_t *event);
+
+#endif	/* SENSOR_NODE_H */
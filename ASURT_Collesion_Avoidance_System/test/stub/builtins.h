@@ -0,0 +1,13 @@
+/* 
+ * File:   builtins.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+#ifndef BUILTINS_HOST_STUB_H
+#define	BUILTINS_HOST_STUB_H
+
+/* Host stand-in for the XC8 <builtins.h> , the intrinsics the firmware uses are in xc.h */
+
+#endif	/* BUILTINS_HOST_STUB_H */
@@ -0,0 +1,191 @@
+/* 
+ * File:   pic18f4620.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+#ifndef PIC18F4620_HOST_STUB_H
+#define	PIC18F4620_HOST_STUB_H
+
+/*
+ * Host stand-in for the XC8 device header : every SFR used by the MCAL layer is a plain variable
+ * (defined in pic18f4620_stub.c) so the drivers compile and link with gcc. The xxxbits views are
+ * separate variables from the byte registers , tests set and check the view the driver uses.
+ * RCREG reads pop a simulated receive FIFO and clear RCIF when it runs empty (see pic_stub_rx_push).
+ * TMR1L and TMR1H accesses call pic_stub_tmr1_hook first , a test moves the count there.
+ */
+
+typedef struct { unsigned ADON:1; unsigned GODONE:1; unsigned GO:1; unsigned CHS:4; } ADCON0bits_t;
+extern volatile ADCON0bits_t ADCON0bits;
+extern volatile unsigned char ADCON0;
+typedef struct { unsigned PCFG:4; unsigned VCFG0:1; unsigned VCFG1:1; } ADCON1bits_t;
+extern volatile ADCON1bits_t ADCON1bits;
+extern volatile unsigned char ADCON1;
+typedef struct { unsigned ADCS:3; unsigned ACQT:3; unsigned ADFM:1; } ADCON2bits_t;
+extern volatile ADCON2bits_t ADCON2bits;
+extern volatile unsigned char ADCON2;
+typedef struct { unsigned ABDEN:1; unsigned WUE:1; unsigned BRG16:1; unsigned SCKP:1; unsigned RCIDL:1; unsigned ABDOVF:1; } BAUDCONbits_t;
+extern volatile BAUDCONbits_t BAUDCONbits;
+extern volatile unsigned char BAUDCON;
+typedef struct { unsigned CCP1M:4; unsigned DC1B:2; } CCP1CONbits_t;
+extern volatile CCP1CONbits_t CCP1CONbits;
+extern volatile unsigned char CCP1CON;
+typedef struct { unsigned CCP2M:4; unsigned DC2B:2; } CCP2CONbits_t;
+extern volatile CCP2CONbits_t CCP2CONbits;
+extern volatile unsigned char CCP2CON;
+typedef struct { unsigned RBIF:1; unsigned INT0IF:1; unsigned TMR0IF:1; unsigned RBIE:1; unsigned INT0IE:1; unsigned TMR0IE:1; unsigned PEIE:1; unsigned GIE:1; unsigned GIEL:1; unsigned GIEH:1; } INTCONbits_t;
+extern volatile INTCONbits_t INTCONbits;
+extern volatile unsigned char INTCON;
+typedef struct { unsigned RBIP:1; unsigned TMR0IP:1; unsigned INTEDG2:1; unsigned INTEDG1:1; unsigned INTEDG0:1; unsigned RBPU:1; } INTCON2bits_t;
+extern volatile INTCON2bits_t INTCON2bits;
+extern volatile unsigned char INTCON2;
+typedef struct { unsigned INT1IF:1; unsigned INT2IF:1; unsigned INT1IE:1; unsigned INT2IE:1; unsigned INT1IP:1; unsigned INT2IP:1; } INTCON3bits_t;
+extern volatile INTCON3bits_t INTCON3bits;
+extern volatile unsigned char INTCON3;
+typedef struct { unsigned TMR1IP:1; unsigned TMR2IP:1; unsigned CCP1IP:1; unsigned SSPIP:1; unsigned TXIP:1; unsigned RCIP:1; unsigned ADIP:1; unsigned PSPIP:1; } IPR1bits_t;
+extern volatile IPR1bits_t IPR1bits;
+extern volatile unsigned char IPR1;
+typedef struct { unsigned CCP2IP:1; unsigned TMR3IP:1; unsigned HLVDIP:1; unsigned BCLIP:1; unsigned EEIP:1; unsigned OSCFIP:1; } IPR2bits_t;
+extern volatile IPR2bits_t IPR2bits;
+extern volatile unsigned char IPR2;
+typedef struct { unsigned TMR1IE:1; unsigned TMR2IE:1; unsigned CCP1IE:1; unsigned SSPIE:1; unsigned TXIE:1; unsigned TX1IE:1; unsigned RCIE:1; unsigned ADIE:1; unsigned PSPIE:1; } PIE1bits_t;
+extern volatile PIE1bits_t PIE1bits;
+extern volatile unsigned char PIE1;
+typedef struct { unsigned CCP2IE:1; unsigned TMR3IE:1; unsigned HLVDIE:1; unsigned BCLIE:1; unsigned EEIE:1; unsigned OSCFIE:1; } PIE2bits_t;
+extern volatile PIE2bits_t PIE2bits;
+extern volatile unsigned char PIE2;
+typedef struct { unsigned TMR1IF:1; unsigned TMR2IF:1; unsigned CCP1IF:1; unsigned SSPIF:1; unsigned TXIF:1; unsigned RCIF:1; unsigned ADIF:1; unsigned PSPIF:1; } PIR1bits_t;
+extern volatile PIR1bits_t PIR1bits;
+extern volatile unsigned char PIR1;
+typedef struct { unsigned CCP2IF:1; unsigned TMR3IF:1; unsigned HLVDIF:1; unsigned BCLIF:1; unsigned EEIF:1; unsigned OSCFIF:1; } PIR2bits_t;
+extern volatile PIR2bits_t PIR2bits;
+extern volatile unsigned char PIR2;
+typedef struct { unsigned RB0:1; unsigned RB1:1; unsigned RB2:1; unsigned RB3:1; unsigned RB4:1; unsigned RB5:1; unsigned RB6:1; unsigned RB7:1; } PORTBbits_t;
+extern volatile PORTBbits_t PORTBbits;
+extern volatile unsigned char PORTB;
+typedef struct { unsigned RC0:1; unsigned RC1:1; unsigned RC2:1; unsigned RC3:1; unsigned RC4:1; unsigned RC5:1; unsigned RC6:1; unsigned RC7:1; } PORTCbits_t;
+extern volatile PORTCbits_t PORTCbits;
+extern volatile unsigned char PORTC;
+typedef struct { unsigned BOR:1; unsigned POR:1; unsigned PD:1; unsigned TO:1; unsigned RI:1; unsigned SBOREN:1; unsigned IPEN:1; } RCONbits_t;
+extern volatile RCONbits_t RCONbits;
+extern volatile unsigned char RCON;
+typedef struct { unsigned RX9D:1; unsigned OERR:1; unsigned FERR:1; unsigned ADDEN:1; unsigned CREN:1; unsigned SREN:1; unsigned RX9:1; unsigned SPEN:1; } RCSTAbits_t;
+extern volatile RCSTAbits_t RCSTAbits;
+extern volatile unsigned char RCSTA;
+typedef struct { unsigned T0PS:3; unsigned PSA:1; unsigned T0SE:1; unsigned T0CS:1; unsigned T08BIT:1; unsigned TMR0ON:1; } T0CONbits_t;
+extern volatile T0CONbits_t T0CONbits;
+extern volatile unsigned char T0CON;
+typedef struct { unsigned TMR1ON:1; unsigned TMR1CS:1; unsigned T1SYNC:1; unsigned T1OSCEN:1; unsigned T1CKPS:2; unsigned T1RUN:1; unsigned RD16:1; } T1CONbits_t;
+extern volatile T1CONbits_t T1CONbits;
+extern volatile unsigned char T1CON;
+typedef struct { unsigned T2CKPS:2; unsigned TMR2ON:1; unsigned TOUTPS:4; } T2CONbits_t;
+extern volatile T2CONbits_t T2CONbits;
+extern volatile unsigned char T2CON;
+typedef struct { unsigned TMR3ON:1; unsigned TMR3CS:1; unsigned T3SYNC:1; unsigned T3CCP1:1; unsigned T3CKPS:2; unsigned T3CCP2:1; unsigned RD16:1; } T3CONbits_t;
+extern volatile T3CONbits_t T3CONbits;
+extern volatile unsigned char T3CON;
+typedef struct { unsigned RC0:1; unsigned RC1:1; unsigned RC2:1; unsigned RC3:1; unsigned RC4:1; unsigned RC5:1; unsigned RC6:1; unsigned RC7:1; } TRISCbits_t;
+extern volatile TRISCbits_t TRISCbits;
+extern volatile unsigned char TRISC;
+typedef struct { unsigned TX9D:1; unsigned TRMT:1; unsigned BRGH:1; unsigned SENDB:1; unsigned SYNC:1; unsigned TXEN:1; unsigned TX9:1; unsigned CSRC:1; } TXSTAbits_t;
+extern volatile TXSTAbits_t TXSTAbits;
+extern volatile unsigned char TXSTA;
+typedef struct { unsigned SCS:2; unsigned IOFS:1; unsigned OSTS:1; unsigned IRCF:3; unsigned IDLEN:1; } OSCCONbits_t;
+extern volatile OSCCONbits_t OSCCONbits;
+extern volatile unsigned char OSCCON;
+typedef struct { unsigned RB0:1; unsigned RB1:1; unsigned RB2:1; unsigned RB3:1; unsigned RB4:1; unsigned RB5:1; unsigned RB6:1; unsigned RB7:1; } TRISBbits_t;
+extern volatile TRISBbits_t TRISBbits;
+extern volatile unsigned char TRISB;
+typedef struct { unsigned LATC0:1; unsigned LATC1:1; unsigned LATC2:1; unsigned LATC3:1; unsigned LATC4:1; unsigned LATC5:1; unsigned LATC6:1; unsigned LATC7:1; } LATCbits_t;
+extern volatile LATCbits_t LATCbits;
+extern volatile unsigned char LATC;
+typedef struct { unsigned LATD0:1; unsigned LATD1:1; unsigned LATD2:1; unsigned LATD3:1; unsigned LATD4:1; unsigned LATD5:1; unsigned LATD6:1; unsigned LATD7:1; } LATDbits_t;
+extern volatile LATDbits_t LATDbits;
+extern volatile unsigned char LATD;
+extern volatile unsigned char TXREG;
+extern volatile unsigned char SPBRG;
+extern volatile unsigned char SPBRGH;
+extern volatile unsigned char TMR0H;
+extern volatile unsigned char TMR0L;
+extern volatile unsigned char TMR0;
+extern volatile unsigned char TMR1;
+extern volatile unsigned char TMR3H;
+extern volatile unsigned char TMR3L;
+extern volatile unsigned char TMR3;
+extern volatile unsigned char TMR2;
+extern volatile unsigned char PR2;
+extern volatile unsigned char ADRESH;
+extern volatile unsigned char ADRESL;
+extern volatile unsigned char CCPR1L;
+extern volatile unsigned char CCPR1H;
+extern volatile unsigned char CCPR2L;
+extern volatile unsigned char CCPR2H;
+extern volatile unsigned char TRISA;
+extern volatile unsigned char TRISD;
+extern volatile unsigned char TRISE;
+extern volatile unsigned char LATA;
+extern volatile unsigned char LATB;
+extern volatile unsigned char LATE;
+extern volatile unsigned char PORTA;
+extern volatile unsigned char PORTD;
+extern volatile unsigned char PORTE;
+extern volatile unsigned char WREG;
+extern volatile unsigned char STATUS;
+
+#define _TRISA_RA0_POSN 0
+#define _TRISA_RA1_POSN 1
+#define _TRISA_RA2_POSN 2
+#define _TRISA_RA3_POSN 3
+#define _TRISA_RA4_POSN 4
+#define _TRISA_RA5_POSN 5
+#define _TRISA_RA6_POSN 6
+#define _TRISA_RA7_POSN 7
+#define _TRISB_RB0_POSN 0
+#define _TRISB_RB1_POSN 1
+#define _TRISB_RB2_POSN 2
+#define _TRISB_RB3_POSN 3
+#define _TRISB_RB4_POSN 4
+#define _TRISB_RB5_POSN 5
+#define _TRISB_RB6_POSN 6
+#define _TRISB_RB7_POSN 7
+#define _TRISC_RC0_POSN 0
+#define _TRISC_RC1_POSN 1
+#define _TRISC_RC2_POSN 2
+#define _TRISC_RC3_POSN 3
+#define _TRISC_RC4_POSN 4
+#define _TRISC_RC5_POSN 5
+#define _TRISC_RC6_POSN 6
+#define _TRISC_RC7_POSN 7
+#define _TRISD_RD0_POSN 0
+#define _TRISD_RD1_POSN 1
+#define _TRISD_RD2_POSN 2
+#define _TRISD_RD3_POSN 3
+#define _TRISD_RD4_POSN 4
+#define _TRISD_RD5_POSN 5
+#define _TRISD_RD6_POSN 6
+#define _TRISD_RD7_POSN 7
+#define _TRISE_RE0_POSN 0
+#define _TRISE_RE1_POSN 1
+#define _TRISE_RE2_POSN 2
+#define _TRISE_RE3_POSN 3
+#define _TRISE_RE4_POSN 4
+#define _TRISE_RE5_POSN 5
+#define _TRISE_RE6_POSN 6
+#define _TRISE_RE7_POSN 7
+
+/* Receive FIFO model behind RCREG */
+unsigned char pic_stub_rcreg_read(void);
+void pic_stub_rx_push(unsigned char _byte);
+void pic_stub_reset(void);
+#define RCREG   (pic_stub_rcreg_read())
+
+/* Timer1 count behind TMR1L/TMR1H : the hook (NULL after pic_stub_reset) runs before every access
+   with _high_byte = 1 for TMR1H , it can change the registers and raise TMR1IF between two reads */
+extern void (*pic_stub_tmr1_hook)(unsigned char _high_byte);
+volatile unsigned char *pic_stub_tmr1l_access(void);
+volatile unsigned char *pic_stub_tmr1h_access(void);
+#define TMR1L   (*pic_stub_tmr1l_access())
+#define TMR1H   (*pic_stub_tmr1h_access())
+
+#endif	/* PIC18F4620_HOST_STUB_H */
@@ -0,0 +1,158 @@
+/* 
+ * File:   pic18f4620_stub.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+#include <string.h>
+#include "pic18f4620.h"
+
+volatile ADCON0bits_t ADCON0bits;
+volatile unsigned char ADCON0;
+volatile ADCON1bits_t ADCON1bits;
+volatile unsigned char ADCON1;
+volatile ADCON2bits_t ADCON2bits;
+volatile unsigned char ADCON2;
+volatile BAUDCONbits_t BAUDCONbits;
+volatile unsigned char BAUDCON;
+volatile CCP1CONbits_t CCP1CONbits;
+volatile unsigned char CCP1CON;
+volatile CCP2CONbits_t CCP2CONbits;
+volatile unsigned char CCP2CON;
+volatile INTCONbits_t INTCONbits;
+volatile unsigned char INTCON;
+volatile INTCON2bits_t INTCON2bits;
+volatile unsigned char INTCON2;
+volatile INTCON3bits_t INTCON3bits;
+volatile unsigned char INTCON3;
+volatile IPR1bits_t IPR1bits;
+volatile unsigned char IPR1;
+volatile IPR2bits_t IPR2bits;
+volatile unsigned char IPR2;
+volatile PIE1bits_t PIE1bits;
+volatile unsigned char PIE1;
+volatile PIE2bits_t PIE2bits;
+volatile unsigned char PIE2;
+volatile PIR1bits_t PIR1bits;
+volatile unsigned char PIR1;
+volatile PIR2bits_t PIR2bits;
+volatile unsigned char PIR2;
+volatile PORTBbits_t PORTBbits;
+volatile unsigned char PORTB;
+volatile PORTCbits_t PORTCbits;
+volatile unsigned char PORTC;
+volatile RCONbits_t RCONbits;
+volatile unsigned char RCON;
+volatile RCSTAbits_t RCSTAbits;
+volatile unsigned char RCSTA;
+volatile T0CONbits_t T0CONbits;
+volatile unsigned char T0CON;
+volatile T1CONbits_t T1CONbits;
+volatile unsigned char T1CON;
+volatile T2CONbits_t T2CONbits;
+volatile unsigned char T2CON;
+volatile T3CONbits_t T3CONbits;
+volatile unsigned char T3CON;
+volatile TRISCbits_t TRISCbits;
+volatile unsigned char TRISC;
+volatile TXSTAbits_t TXSTAbits;
+volatile unsigned char TXSTA;
+volatile OSCCONbits_t OSCCONbits;
+volatile unsigned char OSCCON;
+volatile TRISBbits_t TRISBbits;
+volatile unsigned char TRISB;
+volatile LATCbits_t LATCbits;
+volatile unsigned char LATC;
+volatile LATDbits_t LATDbits;
+volatile unsigned char LATD;
+volatile unsigned char TXREG;
+volatile unsigned char SPBRG;
+volatile unsigned char SPBRGH;
+volatile unsigned char TMR0H;
+volatile unsigned char TMR0L;
+volatile unsigned char TMR0;
+volatile unsigned char TMR1;
+volatile unsigned char TMR3H;
+volatile unsigned char TMR3L;
+volatile unsigned char TMR3;
+volatile unsigned char TMR2;
+volatile unsigned char PR2;
+volatile unsigned char ADRESH;
+volatile unsigned char ADRESL;
+volatile unsigned char CCPR1L;
+volatile unsigned char CCPR1H;
+volatile unsigned char CCPR2L;
+volatile unsigned char CCPR2H;
+volatile unsigned char TRISA;
+volatile unsigned char TRISD;
+volatile unsigned char TRISE;
+volatile unsigned char LATA;
+volatile unsigned char LATB;
+volatile unsigned char LATE;
+volatile unsigned char PORTA;
+volatile unsigned char PORTD;
+volatile unsigned char PORTE;
+volatile unsigned char WREG;
+volatile unsigned char STATUS;
+
+/* Two-character hardware FIFO plus the shift register : a third byte pending sets OERR */
+#define PIC_STUB_RX_FIFO_SIZE   3U
+static unsigned char pic_stub_rx_fifo[PIC_STUB_RX_FIFO_SIZE];
+static unsigned char pic_stub_rx_count = 0;
+
+void pic_stub_rx_push(unsigned char _byte){
+    if(pic_stub_rx_count < PIC_STUB_RX_FIFO_SIZE){
+        pic_stub_rx_fifo[pic_stub_rx_count] = _byte;
+        pic_stub_rx_count++;
+    }
+    else{
+        RCSTAbits.OERR = 1;
+    }
+    PIR1bits.RCIF = 1;
+}
+
+unsigned char pic_stub_rcreg_read(void){
+    unsigned char l_byte = 0;
+    if(0 != pic_stub_rx_count){
+        l_byte = pic_stub_rx_fifo[0];
+        memmove(pic_stub_rx_fifo , &pic_stub_rx_fifo[1] , (size_t)(pic_stub_rx_count - 1U));
+        pic_stub_rx_count--;
+    }
+    if(0 == pic_stub_rx_count){
+        PIR1bits.RCIF = 0;
+    }
+    return l_byte;
+}
+
+void (*pic_stub_tmr1_hook)(unsigned char _high_byte) = NULL;
+static volatile unsigned char pic_stub_tmr1l = 0;
+static volatile unsigned char pic_stub_tmr1h = 0;
+
+/* The hook is detached while it runs , it can write TMR1L/TMR1H without calling itself */
+static void pic_stub_tmr1_call_hook(unsigned char _high_byte){
+    void (*l_hook)(unsigned char _high_byte) = pic_stub_tmr1_hook;
+    if(NULL != l_hook){
+        pic_stub_tmr1_hook = NULL;
+        l_hook(_high_byte);
+        pic_stub_tmr1_hook = l_hook;
+    }
+}
+
+volatile unsigned char *pic_stub_tmr1l_access(void){
+    pic_stub_tmr1_call_hook(0);
+    return &pic_stub_tmr1l;
+}
+
+volatile unsigned char *pic_stub_tmr1h_access(void){
+    pic_stub_tmr1_call_hook(1);
+    return &pic_stub_tmr1h;
+}
+
+void pic_stub_reset(void){
+    pic_stub_tmr1_hook = NULL;
+    pic_stub_rx_count = 0;
+    PIR1bits.RCIF = 0;
+    RCSTAbits.OERR = 0;
+    RCSTAbits.FERR = 0;
+}
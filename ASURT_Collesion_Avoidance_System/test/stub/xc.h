@@ -0,0 +1,22 @@
+/* 
+ * File:   xc.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+#ifndef XC_HOST_STUB_H
+#define	XC_HOST_STUB_H
+
+/* Host stand-in for <xc.h> : the device header and the XC8 intrinsics used by the firmware */
+#include "pic18f4620.h"
+
+#define __interrupt(...)
+#define SLEEP()             ((void)0)
+#define NOP()               ((void)0)
+#define __delay_us(x)       ((void)0)
+#define __delay_ms(x)       ((void)0)
+#define di()                ((void)0)
+#define ei()                ((void)0)
+
+#endif	/* XC_HOST_STUB_H */
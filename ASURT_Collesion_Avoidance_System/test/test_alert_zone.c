@@ -0,0 +1,91 @@
+/* 
+ * File:   test_alert_zone.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Warning zones : distance and time-to-collision hysteresis , bounded buzzer cadence */
+
+#include "test_assert.h"
+#include "../ECU_Layer/Alert_Zone/ecu_alert_zone.h"
+
+#define TEST_TTC_NONE       0xFFFFU
+
+static alert_zone_id_t test_update(alert_zone_t *_zone , uint16 _distance , uint16 _ttc_ms){
+    uint8 l_changed = 0;
+    (void)alert_zone_update(_zone , _distance , _ttc_ms , &l_changed);
+    return _zone->zone;
+}
+
+static void test_distance_hysteresis(void){
+    alert_zone_t l_zone;
+    uint8 l_changed = 0;
+    TEST_ASSERT_EQUAL(E_OK , alert_zone_init(&l_zone));
+    TEST_ASSERT_EQUAL(ALERT_ZONE_FAR , test_update(&l_zone , ALERT_ZONE_CAUTION_ENTRY + 1U , TEST_TTC_NONE));
+    TEST_ASSERT_EQUAL(ALERT_ZONE_CAUTION , test_update(&l_zone , ALERT_ZONE_CAUTION_ENTRY , TEST_TTC_NONE));
+    /* Inside the band : held */
+    TEST_ASSERT_EQUAL(ALERT_ZONE_CAUTION , test_update(&l_zone , ALERT_ZONE_CAUTION_EXIT , TEST_TTC_NONE));
+    TEST_ASSERT_EQUAL(ALERT_ZONE_FAR , test_update(&l_zone , ALERT_ZONE_CAUTION_EXIT + 1U , TEST_TTC_NONE));
+    /* A more severe zone is entered at once , skipping the ones between */
+    (void)alert_zone_update(&l_zone , ALERT_ZONE_CRITICAL_ENTRY , TEST_TTC_NONE , &l_changed);
+    TEST_ASSERT_EQUAL(ALERT_ZONE_CRITICAL , l_zone.zone);
+    TEST_ASSERT_EQUAL(1 , l_changed);
+    (void)alert_zone_update(&l_zone , ALERT_ZONE_CRITICAL_EXIT , TEST_TTC_NONE , &l_changed);
+    TEST_ASSERT_EQUAL(ALERT_ZONE_CRITICAL , l_zone.zone);
+    TEST_ASSERT_EQUAL(0 , l_changed);
+    /* Stepping out lands in the zone of the distance , not in the next one down */
+    TEST_ASSERT_EQUAL(ALERT_ZONE_CAUTION , test_update(&l_zone , ALERT_ZONE_WARNING_EXIT + 1U , TEST_TTC_NONE));
+    /* Beyond the lookup table */
+    TEST_ASSERT_EQUAL(ALERT_ZONE_FAR , test_update(&l_zone , 4000U , TEST_TTC_NONE));
+    TEST_ASSERT_EQUAL(ALERT_ZONE_FAR , test_update(&l_zone , 0xFFFFU , TEST_TTC_NONE));
+}
+
+static void test_ttc_escalation(void){
+    alert_zone_t l_zone;
+    (void)alert_zone_init(&l_zone);
+    TEST_ASSERT_EQUAL(ALERT_ZONE_CRITICAL , test_update(&l_zone , 400U , ALERT_ZONE_CRITICAL_TTC_ENTRY));
+    TEST_ASSERT_EQUAL(ALERT_ZONE_FAR , l_zone.distance_zone);
+    TEST_ASSERT_EQUAL(ALERT_ZONE_CRITICAL , test_update(&l_zone , 400U , ALERT_ZONE_CRITICAL_TTC_EXIT));
+    TEST_ASSERT_EQUAL(ALERT_ZONE_WARNING , test_update(&l_zone , 400U , ALERT_ZONE_CRITICAL_TTC_EXIT + 1U));
+    TEST_ASSERT_EQUAL(ALERT_ZONE_FAR , test_update(&l_zone , 400U , TEST_TTC_NONE));
+    /* The most severe of the two zones is reported */
+    TEST_ASSERT_EQUAL(ALERT_ZONE_WARNING , test_update(&l_zone , ALERT_ZONE_WARNING_ENTRY , ALERT_ZONE_CAUTION_TTC_ENTRY));
+}
+
+/* The half-period follows 10 ms per cm inside the distance band of the zone and is bounded by the
+   cadence at its EXIT distance otherwise , far distances do not wrap the 16-bit period */
+static void test_buzzer_half_period_bounded(void){
+    alert_zone_t l_zone;
+    uint16 l_half_period = 0xAAAA;
+    (void)alert_zone_init(&l_zone);
+    TEST_ASSERT_EQUAL(E_OK , alert_zone_get_buzzer_half_period(&l_zone , 20U , &l_half_period));
+    TEST_ASSERT_EQUAL(0 , l_half_period);
+    (void)test_update(&l_zone , 12U , TEST_TTC_NONE);
+    (void)alert_zone_get_buzzer_half_period(&l_zone , 12U , &l_half_period);
+    TEST_ASSERT_EQUAL(120 , l_half_period);
+    (void)alert_zone_get_buzzer_half_period(&l_zone , 0U , &l_half_period);
+    TEST_ASSERT_EQUAL(10 , l_half_period);
+    (void)alert_zone_get_buzzer_half_period(&l_zone , ALERT_ZONE_CRITICAL_EXIT , &l_half_period);
+    TEST_ASSERT_EQUAL(10U * ALERT_ZONE_CRITICAL_EXIT , l_half_period);
+    /* Critical on its time-to-collision at 4 m : the critical cadence , not a 4 s half-period */
+    (void)test_update(&l_zone , 400U , ALERT_ZONE_CRITICAL_TTC_ENTRY);
+    (void)alert_zone_get_buzzer_half_period(&l_zone , 400U , &l_half_period);
+    TEST_ASSERT_EQUAL(10U * ALERT_ZONE_CRITICAL_EXIT , l_half_period);
+    /* 6554 cm and more used to wrap the 16-bit product */
+    (void)test_update(&l_zone , 6554U , ALERT_ZONE_CRITICAL_TTC_ENTRY);
+    (void)alert_zone_get_buzzer_half_period(&l_zone , 6554U , &l_half_period);
+    TEST_ASSERT_EQUAL(10U * ALERT_ZONE_CRITICAL_EXIT , l_half_period);
+    (void)test_update(&l_zone , 0xFFFEU , ALERT_ZONE_CAUTION_TTC_ENTRY);
+    TEST_ASSERT_EQUAL(ALERT_ZONE_CAUTION , l_zone.zone);
+    (void)alert_zone_get_buzzer_half_period(&l_zone , 0xFFFEU , &l_half_period);
+    TEST_ASSERT_EQUAL(10U * ALERT_ZONE_CAUTION_EXIT , l_half_period);
+    TEST_ASSERT_EQUAL(E_NOT_OK , alert_zone_get_buzzer_half_period(&l_zone , 10U , NULL));
+}
+
+int main(void){
+    TEST_RUN(test_distance_hysteresis);
+    TEST_RUN(test_ttc_escalation);
+    TEST_RUN(test_buzzer_half_period_bounded);
+    return TEST_REPORT();
+}
@@ -0,0 +1,49 @@
+/* 
+ * File:   test_assert.h
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+#ifndef TEST_ASSERT_H
+#define	TEST_ASSERT_H
+
+/***************************************Includes***************************************/
+
+#include <stdio.h>
+
+/***********************************Macro Declarations**********************************/
+
+/* Minimal assertion helpers of the host tests : a failed check is reported and the run goes on */
+static unsigned int test_checks = 0;
+static unsigned int test_failures = 0;
+
+/******************************Macro Function Declarations******************************/
+
+#define TEST_ASSERT(_cond)  do{                                                             \
+        test_checks++;                                                                      \
+        if(!(_cond)){                                                                       \
+            test_failures++;                                                                \
+            printf("%s:%d: FAILED : %s\n" , __FILE__ , __LINE__ , #_cond);                  \
+        }                                                                                   \
+    }while(0)
+
+#define TEST_ASSERT_EQUAL(_expected , _actual)  do{                                         \
+        long test_expected_value = (long)(_expected);                                       \
+        long test_actual_value = (long)(_actual);                                           \
+        test_checks++;                                                                      \
+        if(test_expected_value != test_actual_value){                                       \
+            test_failures++;                                                                \
+            printf("%s:%d: FAILED : %s == %s (expected %ld , got %ld)\n" , __FILE__ ,       \
+                   __LINE__ , #_expected , #_actual ,                                       \
+                   test_expected_value , test_actual_value);                                \
+        }                                                                                   \
+    }while(0)
+
+#define TEST_RUN(_test)     do{ printf("  %s\n" , #_test); _test(); }while(0)
+
+/* Exit status of the test program : 0 when every check passed */
+#define TEST_REPORT()       (printf("  %u checks , %u failed\n" , test_checks , test_failures) , \
+                             ((0U == test_failures) ? 0 : 1))
+
+#endif	/* TEST_ASSERT_H */
@@ -0,0 +1,143 @@
+/* 
+ * File:   test_buzzer_cadence.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Buzzer cadence on a simulated 1 ms tick : the receive path sets the half-period of the zone for
+   each distance , the cadence timer toggles the buzzer. Every edge interval must be 10 x d ms
+   within TEST_EDGE_TOLERANCE_MS , the tick granularity */
+
+#include "test_assert.h"
+#include "../ECU_Layer/Soft_Timer/ecu_soft_timer.h"
+#include "../ECU_Layer/Alert_Zone/ecu_alert_zone.h"
+
+#define TEST_EDGE_TOLERANCE_MS      1U
+/* A distance frame every 50 ms , like the sensor node */
+#define TEST_FRAME_PERIOD_MS        50U
+#define TEST_MAX_EDGES              256U
+
+static soft_timer_t test_cadence_timer;
+static alert_zone_t test_zone;
+static uint16 test_tick = 0;
+static uint16 test_edges[TEST_MAX_EDGES];
+static uint16 test_edge_count = 0;
+
+static void test_buzzer_toggle(void){
+    if(test_edge_count < TEST_MAX_EDGES){
+        test_edges[test_edge_count] = test_tick;
+        test_edge_count++;
+    }
+    else{ /* Nothing */ }
+}
+
+/* Receive path of the application : zone update then cadence update */
+static void test_distance_received(uint16 _distance , uint16 _ttc_ms){
+    uint8 l_changed = 0;
+    uint8 l_active = 0;
+    uint16 l_half_period = 0;
+    (void)alert_zone_update(&test_zone , _distance , _ttc_ms , &l_changed);
+    (void)alert_zone_get_buzzer_half_period(&test_zone , _distance , &l_half_period);
+    (void)soft_timer_is_active(&test_cadence_timer , &l_active);
+    if(0 != l_half_period){
+        (void)soft_timer_set_period(&test_cadence_timer , l_half_period);
+        if(0 == l_active){
+            (void)soft_timer_start(&test_cadence_timer);
+            test_buzzer_toggle();
+        }
+        else{ /* Nothing */ }
+    }
+    else{
+        (void)soft_timer_stop(&test_cadence_timer);
+    }
+}
+
+static void test_setup(void){
+    test_tick = 0;
+    test_edge_count = 0;
+    (void)soft_timer_init(0);
+    (void)alert_zone_init(&test_zone);
+    (void)soft_timer_create(&test_cadence_timer , test_buzzer_toggle , 100 , SOFT_TIMER_PERIODIC);
+}
+
+/* Runs _ms ticks , a frame of _distance arrives every TEST_FRAME_PERIOD_MS */
+static void test_run(uint16 _ms , uint16 _distance , uint16 _ttc_ms){
+    uint16 l_ms = 0;
+    for(l_ms = 0 ; l_ms < _ms ; l_ms++){
+        if(0U == (test_tick % TEST_FRAME_PERIOD_MS)){
+            test_distance_received(_distance , _ttc_ms);
+        }
+        else{ /* Nothing */ }
+        test_tick++;
+        (void)soft_timer_process(test_tick);
+    }
+}
+
+/* Intervals ending on the edges _first + 1 to _last , all within the tolerance of _expected_ms */
+static uint8 test_intervals_match(uint16 _first , uint16 _last , uint16 _expected_ms){
+    uint16 l_index = 0;
+    uint16 l_interval = 0;
+    uint8 l_match = 1;
+    for(l_index = (uint16)(_first + 1U) ; l_index <= _last ; l_index++){
+        l_interval = (uint16)(test_edges[l_index] - test_edges[l_index - 1U]);
+        if((l_interval + TEST_EDGE_TOLERANCE_MS < _expected_ms) || (l_interval > _expected_ms + TEST_EDGE_TOLERANCE_MS)){
+            printf("    edge %u : %u ms , expected %u ms\n" , l_index , l_interval , _expected_ms);
+            l_match = 0;
+        }
+        else{ /* Nothing */ }
+    }
+    return l_match;
+}
+
+static void test_cadence_is_ten_times_distance(void){
+    const uint16 l_distances[] = {1U , 5U , ALERT_ZONE_CRITICAL_ENTRY , 24U , ALERT_ZONE_WARNING_ENTRY , 42U , ALERT_ZONE_CAUTION_ENTRY};
+    uint8 l_index = 0;
+    for(l_index = 0 ; l_index < (uint8)(sizeof(l_distances) / sizeof(l_distances[0])) ; l_index++){
+        test_setup();
+        test_run(5000 , l_distances[l_index] , 0xFFFFU);
+        TEST_ASSERT(test_edge_count > 8U);
+        TEST_ASSERT_EQUAL(1 , test_intervals_match(0 , test_edge_count - 1U , (uint16)(10U * l_distances[l_index])));
+        (void)soft_timer_stop(&test_cadence_timer);
+    }
+}
+
+/* The running half-period completes , the next edges follow the new distance */
+static void test_cadence_follows_distance(void){
+    uint16 l_first_new = 0;
+    test_setup();
+    test_run(1000 , 40U , 0xFFFFU);
+    l_first_new = test_edge_count;
+    test_run(2000 , 20U , 0xFFFFU);
+    TEST_ASSERT(l_first_new > 2U);
+    /* The first edge after the change still ends a 400 ms half-period , then 200 ms */
+    TEST_ASSERT_EQUAL(1 , test_intervals_match(0 , l_first_new , 400U));
+    TEST_ASSERT_EQUAL(1 , test_intervals_match(l_first_new , test_edge_count - 1U , 200U));
+    TEST_ASSERT(test_edge_count > (l_first_new + 5U));
+    (void)soft_timer_stop(&test_cadence_timer);
+}
+
+/* Critical on its time-to-collision at 4 m : bounded by the critical cadence */
+static void test_cadence_bounded_on_ttc(void){
+    test_setup();
+    test_run(3000 , 400U , ALERT_ZONE_CRITICAL_TTC_ENTRY);
+    TEST_ASSERT(test_edge_count > 10U);
+    TEST_ASSERT_EQUAL(1 , test_intervals_match(0 , test_edge_count - 1U , (uint16)(10U * ALERT_ZONE_CRITICAL_EXIT)));
+    (void)soft_timer_stop(&test_cadence_timer);
+}
+
+/* Far zone : the buzzer is silent */
+static void test_far_is_silent(void){
+    test_setup();
+    test_run(2000 , 200U , 0xFFFFU);
+    TEST_ASSERT_EQUAL(0 , test_edge_count);
+}
+
+int main(void){
+    printf("  tolerance %u ms\n" , TEST_EDGE_TOLERANCE_MS);
+    TEST_RUN(test_cadence_is_ten_times_distance);
+    TEST_RUN(test_cadence_follows_distance);
+    TEST_RUN(test_cadence_bounded_on_ttc);
+    TEST_RUN(test_far_is_silent);
+    return TEST_REPORT();
+}
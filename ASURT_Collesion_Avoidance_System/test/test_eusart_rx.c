@@ -0,0 +1,159 @@
+/* 
+ * File:   test_eusart_rx.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* EUSART receive ring buffer : bursts fed through EUSART_Rx_ISR and drained by the main loop API */
+
+#include "test_assert.h"
+#include "../MCAL_Layer/EUSART/hal_eusart.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+
+static uint16 test_rx_callbacks = 0;
+static uint16 test_overrun_callbacks = 0;
+
+static void test_rx_handler(void){
+    test_rx_callbacks++;
+}
+
+/* Cycling CREN clears OERR on the device , the stub has no such side effect */
+static void test_overrun_handler(void){
+    test_overrun_callbacks++;
+    RCSTAbits.OERR = 0;
+}
+
+static eusart_t test_eusart = {
+    .EUSART_RxInterruptHandler = test_rx_handler,
+    .EUSART_OverrunErrorHandler = test_overrun_handler,
+    .baudrate_brg_value = EUSART_BRG_BEST_VALUE(EUSART_ASYNC_BAUDRATE),
+    .baudrate_config = EUSART_BRG_BEST_MODE(EUSART_ASYNC_BAUDRATE),
+    .eusart_tx_cfg.eusart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE,
+    .eusart_tx_cfg.eusart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_DISABLE,
+    .eusart_tx_cfg.eusart_tx_interrupt_priority = INTERRUPT_LOW_PRIORITY,
+    .eusart_rx_cfg.eusart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE,
+    .eusart_rx_cfg.eusart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE,
+    .eusart_rx_cfg.eusart_rx_interrupt_priority = INTERRUPT_LOW_PRIORITY,
+    .eusart_rx_cfg.eusart_rx_address_detect_enable = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE,
+};
+
+static void test_setup(void){
+    uint8 l_discard[EUSART_RX_BUFFER_SIZE];
+    uint8 l_read = 0;
+    pic_stub_reset();
+    TEST_ASSERT_EQUAL(E_OK , EUSART_ASYNC_Init(&test_eusart));
+    /* Empty whatever a previous test left in the ring buffer */
+    do{
+        (void)EUSART_ASYNC_Read_Buffer(&test_eusart , l_discard , EUSART_RX_BUFFER_SIZE , &l_read);
+    }while(0 != l_read);
+    (void)EUSART_ASYNC_Clear_Error_Counters(&test_eusart);
+    test_rx_callbacks = 0;
+    test_overrun_callbacks = 0;
+}
+
+/* Bytes arrive two at a time (the depth of the hardware FIFO) between interrupts */
+static void test_feed(uint8 _first , uint16 _count){
+    uint16 l_index = 0;
+    for(l_index = 0 ; l_index < _count ; l_index++){
+        pic_stub_rx_push((uint8)(_first + l_index));
+        if(1U == (l_index & 1U)){
+            EUSART_Rx_ISR();
+        }
+    }
+    if(PIR1bits.RCIF){
+        EUSART_Rx_ISR();
+    }
+}
+
+static void test_burst_fills_buffer_without_loss(void){
+    uint8 l_data[EUSART_RX_BUFFER_SIZE];
+    uint8 l_available = 0;
+    uint8 l_read = 0;
+    uint8 l_dropped = 0;
+    uint8 l_index = 0;
+    test_setup();
+    test_feed(0x10 , EUSART_RX_BUFFER_SIZE);
+    TEST_ASSERT_EQUAL(E_OK , EUSART_ASYNC_Available(&test_eusart , &l_available));
+    TEST_ASSERT_EQUAL(EUSART_RX_BUFFER_SIZE , l_available);
+    TEST_ASSERT_EQUAL(0 , PIR1bits.RCIF);
+    TEST_ASSERT_EQUAL(E_OK , EUSART_ASYNC_Read_Buffer(&test_eusart , l_data , EUSART_RX_BUFFER_SIZE , &l_read));
+    TEST_ASSERT_EQUAL(EUSART_RX_BUFFER_SIZE , l_read);
+    for(l_index = 0 ; l_index < EUSART_RX_BUFFER_SIZE ; l_index++){
+        TEST_ASSERT_EQUAL((uint8)(0x10 + l_index) , l_data[l_index]);
+    }
+    TEST_ASSERT_EQUAL(E_OK , EUSART_ASYNC_Get_Dropped_Bytes(&test_eusart , &l_dropped));
+    TEST_ASSERT_EQUAL(0 , l_dropped);
+    TEST_ASSERT(0 != test_rx_callbacks);
+}
+
+/* Long stream read in small chunks : the free running indexes wrap many times , nothing is lost */
+static void test_stream_across_index_wrap(void){
+    uint8 l_data[7];
+    uint8 l_read = 0;
+    uint8 l_dropped = 0;
+    uint8 l_expected = 0;
+    uint16 l_total = 0;
+    uint16 l_burst = 0;
+    uint8 l_index = 0;
+    uint8 l_in_order = 1;
+    test_setup();
+    for(l_burst = 0 ; l_burst < 400 ; l_burst++){
+        test_feed((uint8)(l_burst * 5U) , 5);
+        (void)EUSART_ASYNC_Read_Buffer(&test_eusart , l_data , (uint8)sizeof(l_data) , &l_read);
+        for(l_index = 0 ; l_index < l_read ; l_index++){
+            if(l_data[l_index] != l_expected){
+                l_in_order = 0;
+            }
+            l_expected++;
+        }
+        l_total += l_read;
+    }
+    TEST_ASSERT_EQUAL(1 , l_in_order);
+    TEST_ASSERT_EQUAL(2000 , l_total);
+    TEST_ASSERT_EQUAL(E_OK , EUSART_ASYNC_Get_Dropped_Bytes(&test_eusart , &l_dropped));
+    TEST_ASSERT_EQUAL(0 , l_dropped);
+}
+
+/* A full ring buffer keeps the oldest bytes and counts the rest as dropped */
+static void test_full_buffer_counts_dropped(void){
+    uint8 l_data[EUSART_RX_BUFFER_SIZE];
+    uint8 l_read = 0;
+    uint8 l_dropped = 0;
+    test_setup();
+    test_feed(0x00 , EUSART_RX_BUFFER_SIZE + 9U);
+    TEST_ASSERT_EQUAL(E_OK , EUSART_ASYNC_Get_Dropped_Bytes(&test_eusart , &l_dropped));
+    TEST_ASSERT_EQUAL(9 , l_dropped);
+    (void)EUSART_ASYNC_Read_Buffer(&test_eusart , l_data , EUSART_RX_BUFFER_SIZE , &l_read);
+    TEST_ASSERT_EQUAL(EUSART_RX_BUFFER_SIZE , l_read);
+    TEST_ASSERT_EQUAL(0x00 , l_data[0]);
+    TEST_ASSERT_EQUAL(EUSART_RX_BUFFER_SIZE - 1U , l_data[EUSART_RX_BUFFER_SIZE - 1U]);
+}
+
+/* A hardware overrun restarts the receiver and is counted , the buffered bytes survive */
+static void test_overrun_restarts_receiver(void){
+    eusart_error_counters_t l_counters;
+    uint8 l_available = 0;
+    test_setup();
+    pic_stub_rx_push(0x41);
+    pic_stub_rx_push(0x42);
+    pic_stub_rx_push(0x43);
+    pic_stub_rx_push(0x44);
+    TEST_ASSERT_EQUAL(1 , RCSTAbits.OERR);
+    EUSART_Rx_ISR();
+    TEST_ASSERT_EQUAL(0 , RCSTAbits.OERR);
+    TEST_ASSERT_EQUAL(1 , test_overrun_callbacks);
+    TEST_ASSERT_EQUAL(E_OK , EUSART_ASYNC_Get_Error_Counters(&test_eusart , &l_counters));
+    TEST_ASSERT_EQUAL(1 , l_counters.overrun_errors);
+    TEST_ASSERT_EQUAL(1 , l_counters.rx_restarts);
+    (void)EUSART_ASYNC_Available(&test_eusart , &l_available);
+    TEST_ASSERT_EQUAL(3 , l_available);
+}
+
+int main(void){
+    TEST_RUN(test_burst_fills_buffer_without_loss);
+    TEST_RUN(test_stream_across_index_wrap);
+    TEST_RUN(test_full_buffer_counts_dropped);
+    TEST_RUN(test_overrun_restarts_receiver);
+    return TEST_REPORT();
+}
@@ -0,0 +1,121 @@
+/* 
+ * File:   test_event_queue.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Event queue : full and empty conditions , FIFO order across the wrap of the 8-bit indexes */
+
+#include "test_assert.h"
+#include "../ECU_Layer/Event_Queue/ecu_event_queue.h"
+
+static void test_empty_queue(void){
+    event_queue_t l_queue;
+    event_t l_event = {.id = 0x55 , .data = 0x5555};
+    uint8 l_empty = 0;
+    TEST_ASSERT_EQUAL(E_OK , event_queue_init(&l_queue));
+    TEST_ASSERT_EQUAL(E_OK , event_queue_is_empty(&l_queue , &l_empty));
+    TEST_ASSERT_EQUAL(1 , l_empty);
+    TEST_ASSERT_EQUAL(E_NOT_OK , event_queue_get(&l_queue , &l_event));
+    TEST_ASSERT_EQUAL(0x55 , l_event.id);
+    TEST_ASSERT_EQUAL(E_NOT_OK , event_queue_init(NULL));
+    TEST_ASSERT_EQUAL(E_NOT_OK , event_queue_get(&l_queue , NULL));
+}
+
+static void test_full_queue_drops(void){
+    event_queue_t l_queue;
+    event_t l_event;
+    uint8 l_index = 0;
+    uint8 l_dropped = 0;
+    uint8 l_empty = 1;
+    (void)event_queue_init(&l_queue);
+    for(l_index = 0 ; l_index < EVENT_QUEUE_SIZE ; l_index++){
+        TEST_ASSERT_EQUAL(E_OK , event_queue_post(&l_queue , l_index , (uint16)(l_index * 1000U)));
+    }
+    TEST_ASSERT_EQUAL(E_NOT_OK , event_queue_post(&l_queue , 0xEE , 0));
+    TEST_ASSERT_EQUAL(E_NOT_OK , event_queue_post(&l_queue , 0xEF , 0));
+    TEST_ASSERT_EQUAL(E_OK , event_queue_get_dropped(&l_queue , &l_dropped));
+    TEST_ASSERT_EQUAL(2 , l_dropped);
+    (void)event_queue_is_empty(&l_queue , &l_empty);
+    TEST_ASSERT_EQUAL(0 , l_empty);
+    /* The queued events are kept , the late ones were lost */
+    for(l_index = 0 ; l_index < EVENT_QUEUE_SIZE ; l_index++){
+        TEST_ASSERT_EQUAL(E_OK , event_queue_get(&l_queue , &l_event));
+        TEST_ASSERT_EQUAL(l_index , l_event.id);
+        TEST_ASSERT_EQUAL(l_index * 1000U , l_event.data);
+    }
+    TEST_ASSERT_EQUAL(E_NOT_OK , event_queue_get(&l_queue , &l_event));
+    (void)event_queue_is_empty(&l_queue , &l_empty);
+    TEST_ASSERT_EQUAL(1 , l_empty);
+}
+
+static void test_dropped_saturates(void){
+    event_queue_t l_queue;
+    uint16 l_index = 0;
+    uint8 l_dropped = 0;
+    (void)event_queue_init(&l_queue);
+    for(l_index = 0 ; l_index < (EVENT_QUEUE_SIZE + 300U) ; l_index++){
+        (void)event_queue_post(&l_queue , 1 , l_index);
+    }
+    (void)event_queue_get_dropped(&l_queue , &l_dropped);
+    TEST_ASSERT_EQUAL(0xFF , l_dropped);
+    (void)event_queue_init(&l_queue);
+    (void)event_queue_get_dropped(&l_queue , &l_dropped);
+    TEST_ASSERT_EQUAL(0 , l_dropped);
+}
+
+/* Producer and consumer at different rates : the free running indexes wrap past 255 many times */
+static void test_fifo_order_across_wrap(void){
+    event_queue_t l_queue;
+    event_t l_event;
+    uint16 l_posted = 0;
+    uint16 l_taken = 0;
+    uint16 l_round = 0;
+    uint8 l_burst = 0;
+    uint8 l_index = 0;
+    uint8 l_in_order = 1;
+    uint8 l_dropped = 0;
+    (void)event_queue_init(&l_queue);
+    for(l_round = 0 ; l_round < 1000 ; l_round++){
+        l_burst = (uint8)((l_round % EVENT_QUEUE_SIZE) + 1U);
+        for(l_index = 0 ; l_index < l_burst ; l_index++){
+            if(E_OK == event_queue_post(&l_queue , (uint8)l_posted , l_posted)){
+                l_posted++;
+            }
+            else{ /* Nothing */ }
+        }
+        /* Drain a little less than was posted , the queue sits between empty and full */
+        for(l_index = 0 ; l_index < (uint8)((l_round % 3U) + 2U) ; l_index++){
+            if(E_OK == event_queue_get(&l_queue , &l_event)){
+                if((l_event.data != l_taken) || (l_event.id != (uint8)l_taken)){
+                    l_in_order = 0;
+                }
+                else{ /* Nothing */ }
+                l_taken++;
+            }
+            else{ /* Nothing */ }
+        }
+    }
+    while(E_OK == event_queue_get(&l_queue , &l_event)){
+        if(l_event.data != l_taken){
+            l_in_order = 0;
+        }
+        else{ /* Nothing */ }
+        l_taken++;
+    }
+    TEST_ASSERT_EQUAL(1 , l_in_order);
+    TEST_ASSERT_EQUAL(l_posted , l_taken);
+    TEST_ASSERT(l_posted > 2000U);
+    /* Rejected posts were counted as dropped , never silently overwritten */
+    (void)event_queue_get_dropped(&l_queue , &l_dropped);
+    TEST_ASSERT(0 != l_dropped);
+}
+
+int main(void){
+    TEST_RUN(test_empty_queue);
+    TEST_RUN(test_full_queue_drops);
+    TEST_RUN(test_dropped_saturates);
+    TEST_RUN(test_fifo_order_across_wrap);
+    return TEST_REPORT();
+}
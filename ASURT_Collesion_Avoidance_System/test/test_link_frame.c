@@ -0,0 +1,254 @@
+/* 
+ * File:   test_link_frame.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Link frame codec : CRC vectors , resynchronisation after garbage , fuzzing and the cost per byte */
+
+#include <string.h>
+#include <time.h>
+#include "test_assert.h"
+#include "../ECU_Layer/Link_Frame/ecu_link_frame.h"
+
+static uint32 test_random_state = 0x12345678UL;
+
+/* Deterministic generator so a failure can be reproduced */
+static uint8 test_random(void){
+    test_random_state = (test_random_state * 1103515245UL) + 12345UL;
+    return (uint8)(test_random_state >> 16);
+}
+
+/* Bitwise CRC-8 , polynomial 0x07 , reference for the ROM table */
+static uint8 test_crc8_bitwise(uint8 _crc , uint8 _byte){
+    uint8 l_bit = 0;
+    _crc ^= _byte;
+    for(l_bit = 0 ; l_bit < 8 ; l_bit++){
+        _crc = (0U != (_crc & 0x80U)) ? (uint8)((uint8)(_crc << 1) ^ 0x07U) : (uint8)(_crc << 1);
+    }
+    return _crc;
+}
+
+static uint8 test_feed(link_frame_parser_t *_parser , const uint8 *_bytes , uint16 _length , link_frame_t *_frames , uint8 _max_frames){
+    uint16 l_index = 0;
+    uint8 l_count = 0;
+    uint8 l_ready = 0;
+    link_frame_t l_frame;
+    for(l_index = 0 ; l_index < _length ; l_index++){
+        (void)link_frame_parser_feed(_parser , _bytes[l_index] , &l_frame , &l_ready);
+        if((1 == l_ready) && (l_count < _max_frames)){
+            _frames[l_count] = l_frame;
+            l_count++;
+        }
+        else{ /* Nothing */ }
+    }
+    return l_count;
+}
+
+static void test_crc_vectors(void){
+    const uint8 l_check[] = "123456789";
+    uint8 l_crc = LINK_FRAME_CRC_INIT;
+    uint16 l_crc_ref = 0;
+    uint16 l_byte = 0;
+    uint8 l_index = 0;
+    uint8 l_table_ok = 1;
+    /* CRC-8/SMBUS check value */
+    for(l_index = 0 ; l_index < 9 ; l_index++){
+        l_crc = link_frame_crc8_update(l_crc , l_check[l_index]);
+    }
+    TEST_ASSERT_EQUAL(0xF4 , l_crc);
+    for(l_crc_ref = 0 ; l_crc_ref < 256 ; l_crc_ref++){
+        for(l_byte = 0 ; l_byte < 256 ; l_byte += 17){
+            if(link_frame_crc8_update((uint8)l_crc_ref , (uint8)l_byte) != test_crc8_bitwise((uint8)l_crc_ref , (uint8)l_byte)){
+                l_table_ok = 0;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(1 , l_table_ok);
+}
+
+static void test_encode_decode(void){
+    const link_frame_t l_sent = {.sequence = 0x3C , .distance = 0xA5A5 , .flags = LINK_FRAME_FLAG_NO_ECHO};
+    const uint8 l_expected[LINK_FRAME_LENGTH] = {0xA5 , 0x3C , 0xA5 , 0xA5 , 0x01 , 0x00};
+    uint8 l_buffer[LINK_FRAME_LENGTH];
+    link_frame_parser_t l_parser;
+    link_frame_t l_frames[2];
+    uint8 l_crc = LINK_FRAME_CRC_INIT;
+    uint8 l_index = 0;
+    TEST_ASSERT_EQUAL(E_OK , link_frame_encode(&l_sent , l_buffer));
+    for(l_index = LINK_FRAME_SEQUENCE_INDEX ; l_index < LINK_FRAME_CRC_INDEX ; l_index++){
+        l_crc = test_crc8_bitwise(l_crc , l_buffer[l_index]);
+    }
+    TEST_ASSERT_EQUAL(0 , memcmp(l_expected , l_buffer , LINK_FRAME_CRC_INDEX));
+    TEST_ASSERT_EQUAL(l_crc , l_buffer[LINK_FRAME_CRC_INDEX]);
+    (void)link_frame_parser_init(&l_parser);
+    TEST_ASSERT_EQUAL(1 , test_feed(&l_parser , l_buffer , LINK_FRAME_LENGTH , l_frames , 2));
+    TEST_ASSERT_EQUAL(l_sent.sequence , l_frames[0].sequence);
+    TEST_ASSERT_EQUAL(l_sent.distance , l_frames[0].distance);
+    TEST_ASSERT_EQUAL(l_sent.flags , l_frames[0].flags);
+    TEST_ASSERT_EQUAL(E_NOT_OK , link_frame_encode(NULL , l_buffer));
+    TEST_ASSERT_EQUAL(E_NOT_OK , link_frame_parser_feed(&l_parser , 0 , NULL , &l_index));
+}
+
+static void test_sequence_gap_and_bad_crc(void){
+    uint8 l_stream[3 * LINK_FRAME_LENGTH];
+    link_frame_t l_frame = {.sequence = 7 , .distance = 120 , .flags = 0};
+    link_frame_t l_frames[3];
+    link_frame_parser_t l_parser;
+    (void)link_frame_encode(&l_frame , &l_stream[0]);
+    l_frame.sequence = 9;
+    (void)link_frame_encode(&l_frame , &l_stream[LINK_FRAME_LENGTH]);
+    l_frame.sequence = 10;
+    (void)link_frame_encode(&l_frame , &l_stream[2 * LINK_FRAME_LENGTH]);
+    l_stream[2 * LINK_FRAME_LENGTH + LINK_FRAME_DISTANCE_LOW_INDEX] ^= 0x10U;
+    (void)link_frame_parser_init(&l_parser);
+    TEST_ASSERT_EQUAL(2 , test_feed(&l_parser , l_stream , sizeof(l_stream) , l_frames , 3));
+    TEST_ASSERT_EQUAL(2 , l_parser.frames_ok);
+    TEST_ASSERT_EQUAL(1 , l_parser.sequence_gaps);
+    TEST_ASSERT_EQUAL(1 , l_parser.crc_errors);
+}
+
+/* A frame cut short by a reset of the sender : its SYNC swallows the start of the next frame */
+static void test_resync_after_truncated_frame(void){
+    uint8 l_stream[2 + LINK_FRAME_LENGTH + LINK_FRAME_LENGTH];
+    link_frame_t l_frame = {.sequence = 0x21 , .distance = 350 , .flags = 0};
+    link_frame_t l_frames[2];
+    link_frame_parser_t l_parser;
+    l_stream[0] = LINK_FRAME_SYNC_BYTE;
+    l_stream[1] = 0x20;
+    (void)link_frame_encode(&l_frame , &l_stream[2]);
+    l_frame.sequence = 0x22;
+    (void)link_frame_encode(&l_frame , &l_stream[2 + LINK_FRAME_LENGTH]);
+    (void)link_frame_parser_init(&l_parser);
+    TEST_ASSERT_EQUAL(2 , test_feed(&l_parser , l_stream , sizeof(l_stream) , l_frames , 2));
+    TEST_ASSERT_EQUAL(0x21 , l_frames[0].sequence);
+    TEST_ASSERT_EQUAL(350 , l_frames[0].distance);
+    TEST_ASSERT_EQUAL(0x22 , l_frames[1].sequence);
+    TEST_ASSERT_EQUAL(1 , l_parser.crc_errors);
+    TEST_ASSERT_EQUAL(0 , l_parser.bytes_discarded);
+}
+
+/* Random garbage , rich in SYNC values , in front of every frame : each frame must still be decoded
+   unless the garbage itself happens to pass the CRC check */
+static void test_resync_after_garbage(void){
+    uint8 l_stream[32 + LINK_FRAME_LENGTH];
+    link_frame_t l_frame = {.sequence = 0 , .distance = 0 , .flags = 0};
+    link_frame_t l_frames[4];
+    link_frame_parser_t l_parser;
+    uint16 l_trial = 0;
+    uint16 l_received = 0;
+    uint16 l_false_frames = 0;
+    uint8 l_length = 0;
+    uint8 l_index = 0;
+    uint8 l_count = 0;
+    (void)link_frame_parser_init(&l_parser);
+    for(l_trial = 0 ; l_trial < 2000 ; l_trial++){
+        l_length = (uint8)(test_random() % 32U);
+        for(l_index = 0 ; l_index < l_length ; l_index++){
+            l_stream[l_index] = (0U == (test_random() & 3U)) ? LINK_FRAME_SYNC_BYTE : test_random();
+        }
+        l_frame.sequence = (uint8)l_trial;
+        l_frame.distance = (uint16)(test_random() | ((uint16)test_random() << 8));
+        (void)link_frame_encode(&l_frame , &l_stream[l_length]);
+        l_count = test_feed(&l_parser , l_stream , (uint16)(l_length + LINK_FRAME_LENGTH) , l_frames , 4);
+        for(l_index = 0 ; l_index < l_count ; l_index++){
+            if((l_frames[l_index].sequence == l_frame.sequence) && (l_frames[l_index].distance == l_frame.distance)){
+                l_received++;
+            }
+            else{
+                l_false_frames++;
+            }
+        }
+        /* A false frame may end inside the real one , leave the parser hunting for the next SYNC */
+        (void)test_feed(&l_parser , (const uint8 *)"\x00\x00\x00\x00\x00" , 5 , l_frames , 4);
+    }
+    printf("    %u/2000 frames after garbage , %u false frames accepted\n" , l_received , l_false_frames);
+    /* Each false frame can cost at most the real frame of its trial */
+    TEST_ASSERT((l_received + l_false_frames) >= 2000U);
+    TEST_ASSERT(l_false_frames <= 40U);
+}
+
+/* Any byte sequence : every reported frame is exactly the last LINK_FRAME_LENGTH bytes fed */
+static void test_fuzz_reported_frames_are_genuine(void){
+    uint8 l_history[LINK_FRAME_LENGTH] = {0};
+    uint8 l_encoded[LINK_FRAME_LENGTH];
+    link_frame_parser_t l_parser;
+    link_frame_t l_frame;
+    uint32 l_index = 0;
+    uint32 l_frames = 0;
+    uint8 l_ready = 0;
+    uint8 l_byte = 0;
+    uint8 l_genuine = 1;
+    (void)link_frame_parser_init(&l_parser);
+    for(l_index = 0 ; l_index < 1000000UL ; l_index++){
+        l_byte = (0U == (test_random() & 7U)) ? LINK_FRAME_SYNC_BYTE : test_random();
+        memmove(l_history , &l_history[1] , LINK_FRAME_LENGTH - 1U);
+        l_history[LINK_FRAME_LENGTH - 1U] = l_byte;
+        (void)link_frame_parser_feed(&l_parser , l_byte , &l_frame , &l_ready);
+        if(1 == l_ready){
+            l_frames++;
+            (void)link_frame_encode(&l_frame , l_encoded);
+            if(0 != memcmp(l_encoded , l_history , LINK_FRAME_LENGTH)){
+                l_genuine = 0;
+            }
+            else{ /* Nothing */ }
+        }
+        else{ /* Nothing */ }
+    }
+    TEST_ASSERT_EQUAL(1 , l_genuine);
+    TEST_ASSERT_EQUAL(l_frames , l_parser.frames_ok);
+    TEST_ASSERT(l_parser.state <= LINK_FRAME_WAIT_CRC);
+}
+
+/* Host time per byte : a clean stream against the worst case , a SYNC in every byte so that every
+   CRC error triggers the longest rescan. Only the ratio carries over to the PIC18 */
+static double test_time_per_byte(const uint8 *_bytes , uint16 _length , uint32 _rounds){
+    link_frame_parser_t l_parser;
+    link_frame_t l_frame;
+    volatile uint8 l_sink = 0;
+    uint8 l_ready = 0;
+    uint32 l_round = 0;
+    uint16 l_index = 0;
+    clock_t l_start = 0;
+    (void)link_frame_parser_init(&l_parser);
+    l_start = clock();
+    for(l_round = 0 ; l_round < _rounds ; l_round++){
+        for(l_index = 0 ; l_index < _length ; l_index++){
+            (void)link_frame_parser_feed(&l_parser , _bytes[l_index] , &l_frame , &l_ready);
+            l_sink ^= l_ready;
+        }
+    }
+    (void)l_sink;
+    return ((double)(clock() - l_start) * 1e9) / ((double)CLOCKS_PER_SEC * (double)_rounds * (double)_length);
+}
+
+static void test_benchmark(void){
+    uint8 l_clean[8 * LINK_FRAME_LENGTH];
+    uint8 l_worst[8 * LINK_FRAME_LENGTH];
+    link_frame_t l_frame = {.sequence = 0 , .distance = 400 , .flags = 0};
+    double l_clean_ns = 0;
+    double l_worst_ns = 0;
+    uint8 l_index = 0;
+    for(l_index = 0 ; l_index < 8 ; l_index++){
+        l_frame.sequence = l_index;
+        (void)link_frame_encode(&l_frame , &l_clean[l_index * LINK_FRAME_LENGTH]);
+    }
+    memset(l_worst , LINK_FRAME_SYNC_BYTE , sizeof(l_worst));
+    l_clean_ns = test_time_per_byte(l_clean , sizeof(l_clean) , 200000UL);
+    l_worst_ns = test_time_per_byte(l_worst , sizeof(l_worst) , 200000UL);
+    printf("    clean stream %.1f ns/byte , worst case %.1f ns/byte (x%.1f)\n" ,
+           l_clean_ns , l_worst_ns , l_worst_ns / l_clean_ns);
+    TEST_ASSERT(l_worst_ns > 0);
+}
+
+int main(void){
+    TEST_RUN(test_crc_vectors);
+    TEST_RUN(test_encode_decode);
+    TEST_RUN(test_sequence_gap_and_bad_crc);
+    TEST_RUN(test_resync_after_truncated_frame);
+    TEST_RUN(test_resync_after_garbage);
+    TEST_RUN(test_fuzz_reported_frames_are_genuine);
+    TEST_RUN(test_benchmark);
+    return TEST_REPORT();
+}
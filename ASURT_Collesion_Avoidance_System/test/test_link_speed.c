@@ -0,0 +1,294 @@
+/* 
+ * File:   test_link_speed.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Link speed negotiation : rate_limit recovery with backoff , upward re-probe from RUNNING ,
+   auto-baud measurements checked against LINK_SPEED_RATE_0 */
+
+#include "test_assert.h"
+#include "../ECU_Layer/Link_Speed/ecu_link_speed.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+
+static eusart_t test_eusart = {
+    .EUSART_RxInterruptHandler = NULL,
+    .baudrate_brg_value = EUSART_BRG_BEST_VALUE(EUSART_ASYNC_BAUDRATE),
+    .baudrate_config = EUSART_BRG_BEST_MODE(EUSART_ASYNC_BAUDRATE),
+    .eusart_tx_cfg.eusart_tx_enable = EUSART_ASYNCHRONOUS_TX_ENABLE,
+    .eusart_tx_cfg.eusart_tx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_TX_ENABLE,
+    .eusart_tx_cfg.eusart_tx_interrupt_priority = INTERRUPT_LOW_PRIORITY,
+    .eusart_rx_cfg.eusart_rx_enable = EUSART_ASYNCHRONOUS_RX_ENABLE,
+    .eusart_rx_cfg.eusart_rx_interrupt_enable = EUSART_ASYNCHRONOUS_INTERRUPT_RX_ENABLE,
+    .eusart_rx_cfg.eusart_rx_interrupt_priority = INTERRUPT_LOW_PRIORITY,
+    .eusart_rx_cfg.eusart_rx_address_detect_enable = EUSART_ASYNCHRONOUS_ADDRESS_DETECT_DISABLE,
+};
+
+static link_speed_t test_link;
+static link_frame_parser_t test_rx_parser;     /* the parser of the node under test */
+static link_frame_parser_t test_tx_parser;     /* decodes what the node under test sent */
+static link_frame_t test_last_sent;
+static uint16 test_frames_sent = 0;
+static uint8 test_peer_sequence = 0;
+
+/* Let the TX interrupt empty the queue , decoding the frames on the way */
+static void test_drain(void){
+    uint8 l_free = 0;
+    uint8 l_ready = 0;
+    link_frame_t l_frame;
+    (void)EUSART_ASYNC_Tx_Queue_Free(&test_eusart , &l_free);
+    while(EUSART_TX_QUEUE_SIZE != l_free){
+        EUSART_Tx_ISR();
+        (void)link_frame_parser_feed(&test_tx_parser , TXREG , &l_frame , &l_ready);
+        if(l_ready){
+            test_last_sent = l_frame;
+            test_frames_sent++;
+        }
+        else{ /* Nothing */ }
+        (void)EUSART_ASYNC_Tx_Queue_Free(&test_eusart , &l_free);
+    }
+}
+
+static void test_setup(link_speed_role_t _role){
+    pic_stub_reset();
+    TXSTAbits.TRMT = 1;
+    TEST_ASSERT_EQUAL(E_OK , EUSART_ASYNC_Init(&test_eusart));
+    (void)EUSART_ASYNC_Clear_Error_Counters(&test_eusart);
+    (void)link_frame_parser_init(&test_rx_parser);
+    (void)link_frame_parser_init(&test_tx_parser);
+    test_drain();
+    test_frames_sent = 0;
+    test_last_sent.distance = 0;
+    TEST_ASSERT_EQUAL(E_OK , link_speed_init(&test_link , &test_eusart , &test_rx_parser , _role));
+}
+
+/* A frame of the peer node */
+static void test_peer_sends(uint8 _command , uint8 _rate_index){
+    uint8 l_consumed = 0;
+    link_frame_t l_frame = {
+        .sequence = test_peer_sequence,
+        .distance = (uint16)(((uint16)_command << 8) | _rate_index),
+        .flags = LINK_FRAME_FLAG_CONTROL
+    };
+    test_peer_sequence++;
+    TEST_ASSERT_EQUAL(E_OK , link_speed_frame_received(&test_link , &l_frame , &l_consumed));
+    TEST_ASSERT_EQUAL(1 , l_consumed);
+}
+
+static void test_period(void){
+    (void)link_speed_periodic(&test_link);
+    test_drain();
+}
+
+/* Initiator from power-up to RUNNING at _rate_index */
+static void test_initiator_negotiate(uint8 _rate_index){
+    test_peer_sends(LINK_SPEED_CMD_STATUS , test_link.rate_index);
+    test_period();
+    TEST_ASSERT_EQUAL(LINK_SPEED_CMD_REQUEST , test_last_sent.distance >> 8);
+    TEST_ASSERT_EQUAL(_rate_index , test_last_sent.distance & 0xFFU);
+    test_peer_sends(LINK_SPEED_CMD_ACK , _rate_index);
+    TEST_ASSERT_EQUAL(LINK_SPEED_VERIFY , test_link.state);
+    test_peer_sends(LINK_SPEED_CMD_STATUS , _rate_index);
+    TEST_ASSERT_EQUAL(LINK_SPEED_RUNNING , test_link.state);
+    TEST_ASSERT_EQUAL(_rate_index , test_link.rate_index);
+}
+
+/* Silence until the initiator gives the rate up */
+static void test_initiator_lose_link(void){
+    uint8 l_period = 0;
+    for(l_period = 0 ; l_period < LINK_SPEED_SILENCE_TIMEOUT ; l_period++){
+        test_period();
+    }
+    TEST_ASSERT_EQUAL(LINK_SPEED_SAFE , test_link.state);
+    TEST_ASSERT_EQUAL(0 , test_link.rate_index);
+}
+
+/* Clean periods with the peer alive , stops early at the first REQUEST */
+static uint16 test_clean_periods_until_request(uint16 _max){
+    uint16 l_period = 0;
+    uint16 l_sent = 0;
+    for(l_period = 1 ; l_period <= _max ; l_period++){
+        test_peer_sends(LINK_SPEED_CMD_STATUS , test_link.rate_index);
+        l_sent = test_frames_sent;
+        test_period();
+        if((test_frames_sent != l_sent) && (LINK_SPEED_CMD_REQUEST == (test_last_sent.distance >> 8))){
+            break;
+        }
+        else{ /* Nothing */ }
+    }
+    return l_period;
+}
+
+static void test_fall_back_lowers_limit(void){
+    test_setup(LINK_SPEED_INITIATOR);
+    test_initiator_negotiate(LINK_SPEED_RATE_COUNT - 1U);
+    test_initiator_lose_link();
+    TEST_ASSERT_EQUAL(LINK_SPEED_RATE_COUNT - 2U , test_link.rate_limit);
+    TEST_ASSERT_EQUAL(1 , test_link.recovery_shift);
+    TEST_ASSERT_EQUAL(1 , test_link.fallbacks);
+}
+
+/* After the doubled window of clean operation the failed rate is requested again from RUNNING */
+static void test_limit_recovers_after_clean_window(void){
+    uint16 l_window = (uint16)LINK_SPEED_RECOVERY_PERIODS << 1;
+    uint16 l_periods = 0;
+    test_setup(LINK_SPEED_INITIATOR);
+    test_initiator_negotiate(LINK_SPEED_RATE_COUNT - 1U);
+    test_initiator_lose_link();
+    /* Negotiation counts as clean operation as well */
+    test_initiator_negotiate(LINK_SPEED_RATE_COUNT - 2U);
+    l_periods = test_clean_periods_until_request(1000);
+    TEST_ASSERT(l_periods <= (l_window + 1U));
+    TEST_ASSERT(l_periods >= (l_window - 2U));
+    TEST_ASSERT_EQUAL(LINK_SPEED_RUNNING , test_link.state);
+    TEST_ASSERT_EQUAL(LINK_SPEED_RATE_COUNT - 1U , test_link.rate_limit);
+    TEST_ASSERT_EQUAL(LINK_SPEED_RATE_COUNT - 1U , test_last_sent.distance & 0xFFU);
+    test_peer_sends(LINK_SPEED_CMD_ACK , LINK_SPEED_RATE_COUNT - 1U);
+    TEST_ASSERT_EQUAL(LINK_SPEED_VERIFY , test_link.state);
+    test_peer_sends(LINK_SPEED_CMD_STATUS , LINK_SPEED_RATE_COUNT - 1U);
+    TEST_ASSERT_EQUAL(LINK_SPEED_RATE_COUNT - 1U , test_link.rate_index);
+    /* A full base window at the top rate forgets the backoff */
+    (void)test_clean_periods_until_request(LINK_SPEED_RECOVERY_PERIODS + 1U);
+    TEST_ASSERT_EQUAL(0 , test_link.recovery_shift);
+}
+
+/* Errors below the fall back threshold restart the window */
+static void test_errors_restart_window(void){
+    uint16 l_period = 0;
+    test_setup(LINK_SPEED_INITIATOR);
+    test_initiator_negotiate(LINK_SPEED_RATE_COUNT - 1U);
+    test_initiator_lose_link();
+    test_initiator_negotiate(LINK_SPEED_RATE_COUNT - 2U);
+    for(l_period = 0 ; l_period < 10 ; l_period++){
+        (void)test_clean_periods_until_request(LINK_SPEED_RECOVERY_PERIODS);
+        test_rx_parser.crc_errors++;
+        test_period();
+    }
+    TEST_ASSERT_EQUAL(LINK_SPEED_RATE_COUNT - 2U , test_link.rate_limit);
+    TEST_ASSERT_EQUAL(LINK_SPEED_RUNNING , test_link.state);
+}
+
+/* Every failed re-probe doubles the window , up to LINK_SPEED_RECOVERY_MAX_SHIFT */
+static void test_backoff_is_bounded(void){
+    uint8 l_attempt = 0;
+    test_setup(LINK_SPEED_INITIATOR);
+    test_initiator_negotiate(LINK_SPEED_RATE_COUNT - 1U);
+    test_initiator_lose_link();
+    for(l_attempt = 0 ; l_attempt < (LINK_SPEED_RECOVERY_MAX_SHIFT + 3U) ; l_attempt++){
+        test_initiator_negotiate(LINK_SPEED_RATE_COUNT - 2U);
+        (void)test_clean_periods_until_request(2000);
+        TEST_ASSERT_EQUAL(LINK_SPEED_RATE_COUNT - 1U , test_link.rate_limit);
+        test_peer_sends(LINK_SPEED_CMD_ACK , LINK_SPEED_RATE_COUNT - 1U);
+        /* The faster rate never answers */
+        while(LINK_SPEED_VERIFY == test_link.state){
+            test_period();
+        }
+    }
+    TEST_ASSERT_EQUAL(LINK_SPEED_RECOVERY_MAX_SHIFT , test_link.recovery_shift);
+    TEST_ASSERT_EQUAL(LINK_SPEED_RATE_COUNT - 2U , test_link.rate_limit);
+}
+
+/* Auto-baud completion as seen by the driver : ABDEN self-cleared , RCIF set , SPBRGH:SPBRG loaded */
+static void test_auto_baud_measured(uint16 _brg_value){
+    SPBRG = (uint8)_brg_value;
+    SPBRGH = (uint8)(_brg_value >> 8);
+    BAUDCONbits.ABDEN = 0;
+    pic_stub_rx_push(0x00);
+}
+
+static void test_auto_baud_rejects_other_rates(void){
+    uint8 l_status = EUSART_AUTO_BAUD_IDLE;
+    uint8 l_rate = 0;
+    static const uint32 l_rates[] = {LINK_SPEED_RATE_1 , LINK_SPEED_RATE_2 , LINK_SPEED_RATE_3};
+    test_setup(LINK_SPEED_RESPONDER);
+    for(l_rate = 0 ; l_rate < 3 ; l_rate++){
+        test_auto_baud_measured((uint16)EUSART_BRG_VALUE(l_rates[l_rate] , 4UL));
+        test_period();
+        TEST_ASSERT_EQUAL(LINK_SPEED_AUTO_BAUD , test_link.state);
+        TEST_ASSERT_EQUAL(l_rate + 1U , test_link.auto_baud_rejects);
+        /* Re-armed */
+        TEST_ASSERT_EQUAL(1 , BAUDCONbits.ABDEN);
+        (void)EUSART_ASYNC_Auto_Baud_Status(&test_eusart , &l_status);
+        TEST_ASSERT_EQUAL(EUSART_AUTO_BAUD_BUSY , l_status);
+    }
+    TEST_ASSERT_EQUAL(0 , test_frames_sent);
+    /* A measurement far below the safe rate (long gap in a frame) is rejected as well */
+    test_auto_baud_measured(0x0FFF);
+    test_period();
+    TEST_ASSERT_EQUAL(LINK_SPEED_AUTO_BAUD , test_link.state);
+    TEST_ASSERT_EQUAL(4 , test_link.auto_baud_rejects);
+}
+
+static void test_auto_baud_accepts_safe_rate(void){
+    uint16 l_brg = (uint16)EUSART_BRG_VALUE(LINK_SPEED_RATE_0 , 4UL);
+    test_setup(LINK_SPEED_RESPONDER);
+    /* One count of measurement quantization */
+    test_auto_baud_measured((uint16)(l_brg + 1U));
+    test_period();
+    TEST_ASSERT_EQUAL(LINK_SPEED_SAFE , test_link.state);
+    TEST_ASSERT_EQUAL(0 , test_link.auto_baud_rejects);
+    TEST_ASSERT_EQUAL(0 , BAUDCONbits.ABDEN);
+    /* The rate runs from the rate table , not the measurement */
+    TEST_ASSERT_EQUAL(EUSART_BRG_BEST_VALUE(LINK_SPEED_RATE_0) , (uint16)(((uint16)SPBRGH << 8) | SPBRG));
+    TEST_ASSERT_EQUAL(1 , test_frames_sent);
+    TEST_ASSERT_EQUAL(LINK_SPEED_CMD_STATUS , test_last_sent.distance >> 8);
+}
+
+/* The responder follows a re-probe requested while RUNNING */
+static void test_responder_accepts_request_when_running(void){
+    test_setup(LINK_SPEED_RESPONDER);
+    test_auto_baud_measured((uint16)EUSART_BRG_VALUE(LINK_SPEED_RATE_0 , 4UL));
+    test_period();
+    test_peer_sends(LINK_SPEED_CMD_REQUEST , 2);
+    TEST_ASSERT_EQUAL(LINK_SPEED_SWITCH_PENDING , test_link.state);
+    test_drain();
+    test_period();
+    TEST_ASSERT_EQUAL(LINK_SPEED_VERIFY , test_link.state);
+    test_peer_sends(LINK_SPEED_CMD_STATUS , 2);
+    TEST_ASSERT_EQUAL(LINK_SPEED_RUNNING , test_link.state);
+    test_peer_sends(LINK_SPEED_CMD_REQUEST , 3);
+    TEST_ASSERT_EQUAL(LINK_SPEED_SWITCH_PENDING , test_link.state);
+    test_drain();
+    TEST_ASSERT_EQUAL(LINK_SPEED_CMD_ACK , test_last_sent.distance >> 8);
+    test_period();
+    TEST_ASSERT_EQUAL(3 , test_link.rate_index);
+}
+
+/* A control frame that does not fit the transmit queue is not numbered , the peer sees no gap */
+static void test_full_queue_keeps_sequence(void){
+    static const uint8 l_filler[LINK_FRAME_LENGTH] = {0};
+    uint8 l_free = 0;
+    uint8 l_sequence = 0;
+    test_setup(LINK_SPEED_RESPONDER);
+    test_auto_baud_measured((uint16)EUSART_BRG_VALUE(LINK_SPEED_RATE_0 , 4UL));
+    test_period();
+    TEST_ASSERT_EQUAL(LINK_SPEED_SAFE , test_link.state);
+    l_sequence = test_link.sequence;
+    /* Leave less room than one frame */
+    do{
+        (void)EUSART_ASYNC_Write_Buffer_Async(&test_eusart , l_filler , 1 , NULL);
+        (void)EUSART_ASYNC_Tx_Queue_Free(&test_eusart , &l_free);
+    }while(l_free >= LINK_FRAME_LENGTH);
+    TEST_ASSERT_EQUAL(E_NOT_OK , link_speed_periodic(&test_link));
+    TEST_ASSERT_EQUAL(l_sequence , test_link.sequence);
+    TEST_ASSERT_EQUAL(E_NOT_OK , link_speed_send_data(&test_link , 100 , 0));
+    TEST_ASSERT_EQUAL(l_sequence , test_link.sequence);
+    test_drain();
+    test_period();
+    TEST_ASSERT_EQUAL(LINK_SPEED_CMD_STATUS , test_last_sent.distance >> 8);
+    TEST_ASSERT_EQUAL(l_sequence , test_last_sent.sequence);
+    TEST_ASSERT_EQUAL((uint8)(l_sequence + 1U) , test_link.sequence);
+}
+
+int main(void){
+    TEST_RUN(test_fall_back_lowers_limit);
+    TEST_RUN(test_limit_recovers_after_clean_window);
+    TEST_RUN(test_errors_restart_window);
+    TEST_RUN(test_backoff_is_bounded);
+    TEST_RUN(test_auto_baud_rejects_other_rates);
+    TEST_RUN(test_auto_baud_accepts_safe_rate);
+    TEST_RUN(test_responder_accepts_request_when_running);
+    TEST_RUN(test_full_queue_keeps_sequence);
+    return TEST_REPORT();
+}
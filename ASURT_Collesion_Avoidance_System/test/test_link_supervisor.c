@@ -0,0 +1,108 @@
+/* 
+ * File:   test_link_supervisor.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Link staleness supervisor : timeout , recovery , outage lengths across the 16-bit tick wrap */
+
+#include "test_assert.h"
+#include "../ECU_Layer/Link_Supervisor/ecu_link_supervisor.h"
+
+/* The link task period of the receiver */
+#define TEST_CHECK_PERIOD       100U
+
+static link_supervisor_t test_supervisor;
+static uint16 test_tick = 0;
+static uint8 test_stale_events = 0;
+
+/* _ms ticks of silence with the periodic check every TEST_CHECK_PERIOD ticks */
+static void test_silence(uint32 _ms){
+    uint32 l_ms = 0;
+    uint8 l_went_stale = 0;
+    for(l_ms = 0 ; l_ms < _ms ; l_ms++){
+        test_tick++;
+        if(0U == (test_tick % TEST_CHECK_PERIOD)){
+            (void)link_supervisor_periodic(&test_supervisor , test_tick , &l_went_stale);
+            test_stale_events += l_went_stale;
+        }
+        else{ /* Nothing */ }
+    }
+}
+
+static uint8 test_frame(void){
+    uint8 l_recovered = 0;
+    (void)link_supervisor_frame_received(&test_supervisor , test_tick , &l_recovered);
+    return l_recovered;
+}
+
+static void test_setup(uint16 _now){
+    test_tick = _now;
+    test_stale_events = 0;
+    TEST_ASSERT_EQUAL(E_OK , link_supervisor_init(&test_supervisor , _now));
+}
+
+static void test_frames_keep_link_fresh(void){
+    uint8 l_stale = 1;
+    uint8 l_index = 0;
+    test_setup(0);
+    for(l_index = 0 ; l_index < 100 ; l_index++){
+        test_silence(LINK_SUPERVISOR_TIMEOUT - TEST_CHECK_PERIOD);
+        TEST_ASSERT_EQUAL(0 , test_frame());
+    }
+    (void)link_supervisor_is_stale(&test_supervisor , &l_stale);
+    TEST_ASSERT_EQUAL(0 , l_stale);
+    TEST_ASSERT_EQUAL(0 , test_stale_events);
+}
+
+/* Declared stale at the first check reaching LINK_SUPERVISOR_TIMEOUT , once per outage */
+static void test_timeout_and_recovery(void){
+    uint8 l_stale = 0;
+    test_setup(0);
+    test_silence(LINK_SUPERVISOR_TIMEOUT - 1U);
+    (void)link_supervisor_is_stale(&test_supervisor , &l_stale);
+    TEST_ASSERT_EQUAL(0 , l_stale);
+    test_silence(TEST_CHECK_PERIOD);
+    (void)link_supervisor_is_stale(&test_supervisor , &l_stale);
+    TEST_ASSERT_EQUAL(1 , l_stale);
+    test_silence(5000);
+    TEST_ASSERT_EQUAL(1 , test_stale_events);
+    test_silence(250);
+    TEST_ASSERT_EQUAL(1 , test_frame());
+    (void)link_supervisor_is_stale(&test_supervisor , &l_stale);
+    TEST_ASSERT_EQUAL(0 , l_stale);
+    /* Counted up to the frame , not to the last check */
+    TEST_ASSERT_EQUAL(LINK_SUPERVISOR_TIMEOUT - 1U + TEST_CHECK_PERIOD + 5000U + 250U , test_supervisor.last_outage);
+    TEST_ASSERT_EQUAL(1 , test_supervisor.outages);
+    TEST_ASSERT_EQUAL(0 , test_frame());
+}
+
+/* Outages longer than the 16-bit tick range are measured in full */
+static void test_long_outage_across_wrap(void){
+    test_setup(65000U);
+    test_silence(200000UL);
+    TEST_ASSERT_EQUAL(1 , test_frame());
+    TEST_ASSERT_EQUAL(200000UL , test_supervisor.last_outage);
+    TEST_ASSERT_EQUAL(200000UL , test_supervisor.longest_outage);
+    test_silence(3000);
+    (void)test_frame();
+    TEST_ASSERT_EQUAL(3000 , test_supervisor.last_outage);
+    TEST_ASSERT_EQUAL(200000UL , test_supervisor.longest_outage);
+    TEST_ASSERT_EQUAL(2 , test_supervisor.outages);
+}
+
+static void test_bad_arguments(void){
+    uint8 l_flag = 0;
+    TEST_ASSERT_EQUAL(E_NOT_OK , link_supervisor_init(NULL , 0));
+    TEST_ASSERT_EQUAL(E_NOT_OK , link_supervisor_periodic(&test_supervisor , 0 , NULL));
+    TEST_ASSERT_EQUAL(E_NOT_OK , link_supervisor_frame_received(NULL , 0 , &l_flag));
+}
+
+int main(void){
+    TEST_RUN(test_frames_keep_link_fresh);
+    TEST_RUN(test_timeout_and_recovery);
+    TEST_RUN(test_long_outage_across_wrap);
+    TEST_RUN(test_bad_arguments);
+    return TEST_REPORT();
+}
@@ -0,0 +1,195 @@
+/* 
+ * File:   test_scheduler.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Time-triggered scheduler driven by a simulated 1 ms tick : release times , overruns , execution time */
+
+#include "test_assert.h"
+#include "../ECU_Layer/Scheduler/ecu_scheduler.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+
+#define TEST_MAX_RUNS       128U
+
+static timer0_t test_timer = {
+    .TMR0_InterruptHandler = NULL,
+    .priority = INTERRUPT_HIGH_PRIORITY,
+    .operation_mode = TIMER0_TIMER_MODE,
+    .register_size = TIMER0_16BIT_REGISTER_MODE,
+    .prescaler_enable = TIMER0_PERIOD_PRESCALER_ENABLE(1000UL),
+    .prescaler_value = TIMER0_PERIOD_PRESCALER_VALUE(1000UL),
+    .preload_value = TIMER0_PERIOD_PRELOAD(1000UL)
+};
+
+static uint16 test_fast_releases[TEST_MAX_RUNS];
+static uint16 test_fast_runs = 0;
+static uint16 test_slow_releases[TEST_MAX_RUNS];
+static uint16 test_slow_runs = 0;
+/* Ticks the next run of the slow task lasts , the tick interrupt keeps firing meanwhile */
+static uint16 test_slow_duration = 0;
+
+/* Timer0 interrupt handler of the application : the tick is simulated through the real TMR0_ISR */
+void Timer0_DefaultInterruptHandler(void){
+    scheduler_tick();
+}
+
+static uint16 test_now(void){
+    uint16 l_ticks = 0;
+    (void)scheduler_get_ticks(&l_ticks);
+    return l_ticks;
+}
+
+static void test_fast_task(void){
+    if(test_fast_runs < TEST_MAX_RUNS){
+        test_fast_releases[test_fast_runs] = test_now();
+    }
+    else{ /* Nothing */ }
+    test_fast_runs++;
+}
+
+static void test_slow_task(void){
+    if(test_slow_runs < TEST_MAX_RUNS){
+        test_slow_releases[test_slow_runs] = test_now();
+    }
+    else{ /* Nothing */ }
+    test_slow_runs++;
+    while(test_slow_duration > 0){
+        TMR0_ISR();
+        test_slow_duration--;
+    }
+}
+
+/* Timer0 counts spent inside the task are set from the simulated timer registers */
+static void test_timed_task(void){
+    uint16 l_counts = (uint16)(SCHEDULER_TIMER0_PRELOAD + 600U);
+    TMR0H = (uint8)(l_counts >> 8);
+    TMR0L = (uint8)l_counts;
+}
+
+static const scheduler_task_t test_tasks[] = {
+    {.task = test_fast_task , .period_ms = 10 , .offset_ms = 0},
+    {.task = test_slow_task , .period_ms = 25 , .offset_ms = 5},
+};
+
+static void test_setup(void){
+    pic_stub_reset();
+    test_fast_runs = 0;
+    test_slow_runs = 0;
+    test_slow_duration = 0;
+    TEST_ASSERT_EQUAL(E_OK , scheduler_init(&test_timer , test_tasks , 2));
+    /* The main loop reaches the scheduler before the first tick : the offset 0 task runs at tick 0 */
+    (void)scheduler_dispatch();
+}
+
+/* One tick interrupt followed by one pass of the main loop */
+static void test_run_ticks(uint32 _ticks){
+    uint32 l_tick = 0;
+    for(l_tick = 0 ; l_tick < _ticks ; l_tick++){
+        TMR0_ISR();
+        (void)scheduler_dispatch();
+    }
+}
+
+static void test_init_rejects_bad_tables(void){
+    const scheduler_task_t l_zero_period[] = {{.task = test_fast_task , .period_ms = 0 , .offset_ms = 0}};
+    const scheduler_task_t l_no_task[] = {{.task = NULL , .period_ms = 5 , .offset_ms = 0}};
+    TEST_ASSERT_EQUAL(E_NOT_OK , scheduler_init(&test_timer , l_zero_period , 1));
+    TEST_ASSERT_EQUAL(E_NOT_OK , scheduler_init(&test_timer , l_no_task , 1));
+    TEST_ASSERT_EQUAL(E_NOT_OK , scheduler_init(&test_timer , test_tasks , 0));
+    TEST_ASSERT_EQUAL(E_NOT_OK , scheduler_init(&test_timer , test_tasks , SCHEDULER_MAX_TASKS + 1U));
+    TEST_ASSERT_EQUAL(E_NOT_OK , scheduler_init(NULL , test_tasks , 2));
+}
+
+static void test_releases_on_time(void){
+    scheduler_task_stats_t l_stats;
+    uint16 l_index = 0;
+    uint8 l_on_time = 1;
+    test_setup();
+    test_run_ticks(1000);
+    TEST_ASSERT_EQUAL(101 , test_fast_runs);
+    TEST_ASSERT_EQUAL(40 , test_slow_runs);
+    for(l_index = 0 ; l_index < 101 ; l_index++){
+        if(test_fast_releases[l_index] != (uint16)(l_index * 10U)){
+            l_on_time = 0;
+        }
+        else{ /* Nothing */ }
+    }
+    for(l_index = 0 ; l_index < 40 ; l_index++){
+        if(test_slow_releases[l_index] != (uint16)(5U + (l_index * 25U))){
+            l_on_time = 0;
+        }
+        else{ /* Nothing */ }
+    }
+    TEST_ASSERT_EQUAL(1 , l_on_time);
+    TEST_ASSERT_EQUAL(E_OK , scheduler_get_task_stats(0 , &l_stats));
+    TEST_ASSERT_EQUAL(101 , l_stats.runs);
+    TEST_ASSERT_EQUAL(0 , l_stats.overruns);
+    TEST_ASSERT_EQUAL(E_NOT_OK , scheduler_get_task_stats(2 , &l_stats));
+}
+
+/* A 35 ms run of the slow task delays the fast task by more than three periods : the missed
+   releases are counted and dropped , the next releases stay on the 10 ms grid */
+static void test_overrun_skips_releases(void){
+    scheduler_task_stats_t l_stats;
+    uint16 l_index = 0;
+    uint8 l_on_grid = 1;
+    test_setup();
+    test_run_ticks(4);
+    test_slow_duration = 35;
+    test_run_ticks(200);
+    (void)scheduler_get_task_stats(0 , &l_stats);
+    TEST_ASSERT_EQUAL(3 , l_stats.overruns);
+    /* The slow task holds the CPU from 5 to 40 : the releases 10 , 20 and 30 are dropped ,
+       the release 40 runs one tick late and the next ones are back on the 10 ms grid */
+    TEST_ASSERT_EQUAL(0 , test_fast_releases[0]);
+    TEST_ASSERT_EQUAL(41 , test_fast_releases[1]);
+    for(l_index = 2 ; l_index < test_fast_runs ; l_index++){
+        if(0U != (test_fast_releases[l_index] % 10U)){
+            l_on_grid = 0;
+        }
+        else{ /* Nothing */ }
+    }
+    TEST_ASSERT_EQUAL(1 , l_on_grid);
+    /* 4 + 35 + 200 ticks : the last release is 230 */
+    TEST_ASSERT_EQUAL(230 , test_fast_releases[test_fast_runs - 1U]);
+    (void)scheduler_get_task_stats(1 , &l_stats);
+    TEST_ASSERT_EQUAL(0 , l_stats.overruns);
+}
+
+/* The 16-bit tick wraps every 65.5 s , the releases must keep their period across it */
+static void test_tick_wrap(void){
+    scheduler_task_stats_t l_stats;
+    test_setup();
+    test_run_ticks(70000UL);
+    (void)scheduler_get_task_stats(0 , &l_stats);
+    TEST_ASSERT_EQUAL(7001 , l_stats.runs);
+    TEST_ASSERT_EQUAL(0 , l_stats.overruns);
+    (void)scheduler_get_task_stats(1 , &l_stats);
+    TEST_ASSERT_EQUAL(2800 , l_stats.runs);
+    TEST_ASSERT_EQUAL(0 , l_stats.overruns);
+}
+
+static void test_execution_time(void){
+    const scheduler_task_t l_tasks[] = {{.task = test_timed_task , .period_ms = 1 , .offset_ms = 0}};
+    scheduler_task_stats_t l_stats;
+    pic_stub_reset();
+    TEST_ASSERT_EQUAL(E_OK , scheduler_init(&test_timer , l_tasks , 1));
+    TMR0H = (uint8)(SCHEDULER_TIMER0_PRELOAD >> 8);
+    TMR0L = (uint8)SCHEDULER_TIMER0_PRELOAD;
+    (void)scheduler_dispatch();
+    (void)scheduler_get_task_stats(0 , &l_stats);
+    TEST_ASSERT_EQUAL(1 , l_stats.runs);
+    TEST_ASSERT_EQUAL(600 , l_stats.last_execution);
+    TEST_ASSERT_EQUAL(600 , l_stats.max_execution);
+}
+
+int main(void){
+    TEST_RUN(test_init_rejects_bad_tables);
+    TEST_RUN(test_releases_on_time);
+    TEST_RUN(test_overrun_skips_releases);
+    TEST_RUN(test_tick_wrap);
+    TEST_RUN(test_execution_time);
+    return TEST_REPORT();
+}
@@ -0,0 +1,205 @@
+/* 
+ * File:   test_soft_timer.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Software timers : delta list ordering , stop in the middle of the list , periodic re-arm */
+
+#include "test_assert.h"
+#include "../ECU_Layer/Soft_Timer/ecu_soft_timer.h"
+
+#define TEST_MAX_FIRES      64U
+
+typedef struct{
+    uint8 id;
+    uint16 tick;
+}test_fire_t;
+
+static soft_timer_t test_timer_a;
+static soft_timer_t test_timer_b;
+static soft_timer_t test_timer_c;
+static uint16 test_tick = 0;
+static test_fire_t test_fires[TEST_MAX_FIRES];
+static uint8 test_fire_count = 0;
+
+static void test_log(uint8 _id){
+    if(test_fire_count < TEST_MAX_FIRES){
+        test_fires[test_fire_count].id = _id;
+        test_fires[test_fire_count].tick = test_tick;
+        test_fire_count++;
+    }
+    else{ /* Nothing */ }
+}
+
+static void test_callback_a(void){ test_log('A'); }
+static void test_callback_b(void){ test_log('B'); }
+static void test_callback_c(void){ test_log('C'); }
+
+/* One-shot timer re-armed by its own callback */
+static void test_callback_restart(void){
+    test_log('R');
+    (void)soft_timer_start(&test_timer_a);
+}
+
+static void test_setup(uint16 _now){
+    test_tick = _now;
+    test_fire_count = 0;
+    TEST_ASSERT_EQUAL(E_OK , soft_timer_init(_now));
+}
+
+/* Processes every _step ticks until _until ticks have elapsed */
+static void test_advance(uint16 _until , uint16 _step){
+    uint16 l_elapsed = 0;
+    while(l_elapsed < _until){
+        l_elapsed += _step;
+        test_tick = (uint16)(test_tick + _step);
+        (void)soft_timer_process(test_tick);
+    }
+}
+
+static void test_expiry_order(void){
+    test_setup(0);
+    (void)soft_timer_create(&test_timer_a , test_callback_a , 30 , SOFT_TIMER_ONE_SHOT);
+    (void)soft_timer_create(&test_timer_b , test_callback_b , 10 , SOFT_TIMER_ONE_SHOT);
+    (void)soft_timer_create(&test_timer_c , test_callback_c , 20 , SOFT_TIMER_ONE_SHOT);
+    (void)soft_timer_start(&test_timer_a);
+    (void)soft_timer_start(&test_timer_b);
+    (void)soft_timer_start(&test_timer_c);
+    /* Delta list : B(10) -> C(+10) -> A(+10) */
+    TEST_ASSERT_EQUAL(10 , test_timer_b.delta);
+    TEST_ASSERT(&test_timer_c == test_timer_b.next);
+    TEST_ASSERT_EQUAL(10 , test_timer_c.delta);
+    TEST_ASSERT(&test_timer_a == test_timer_c.next);
+    TEST_ASSERT_EQUAL(10 , test_timer_a.delta);
+    test_advance(40 , 1);
+    TEST_ASSERT_EQUAL(3 , test_fire_count);
+    TEST_ASSERT_EQUAL('B' , test_fires[0].id);
+    TEST_ASSERT_EQUAL(10 , test_fires[0].tick);
+    TEST_ASSERT_EQUAL('C' , test_fires[1].id);
+    TEST_ASSERT_EQUAL(20 , test_fires[1].tick);
+    TEST_ASSERT_EQUAL('A' , test_fires[2].id);
+    TEST_ASSERT_EQUAL(30 , test_fires[2].tick);
+}
+
+/* Timers expiring on the same tick fire in the order they were started */
+static void test_equal_expiry_keeps_start_order(void){
+    test_setup(0);
+    (void)soft_timer_create(&test_timer_a , test_callback_a , 15 , SOFT_TIMER_ONE_SHOT);
+    (void)soft_timer_create(&test_timer_b , test_callback_b , 15 , SOFT_TIMER_ONE_SHOT);
+    (void)soft_timer_start(&test_timer_b);
+    (void)soft_timer_start(&test_timer_a);
+    test_advance(15 , 1);
+    TEST_ASSERT_EQUAL(2 , test_fire_count);
+    TEST_ASSERT_EQUAL('B' , test_fires[0].id);
+    TEST_ASSERT_EQUAL('A' , test_fires[1].id);
+    TEST_ASSERT_EQUAL(15 , test_fires[1].tick);
+}
+
+/* Stopping the middle timer hands its remaining ticks on , the later timer is not shifted */
+static void test_stop_in_the_middle(void){
+    uint8 l_active = 1;
+    test_setup(0);
+    (void)soft_timer_create(&test_timer_a , test_callback_a , 10 , SOFT_TIMER_ONE_SHOT);
+    (void)soft_timer_create(&test_timer_b , test_callback_b , 20 , SOFT_TIMER_ONE_SHOT);
+    (void)soft_timer_create(&test_timer_c , test_callback_c , 30 , SOFT_TIMER_ONE_SHOT);
+    (void)soft_timer_start(&test_timer_a);
+    (void)soft_timer_start(&test_timer_b);
+    (void)soft_timer_start(&test_timer_c);
+    test_advance(5 , 1);
+    TEST_ASSERT_EQUAL(E_OK , soft_timer_stop(&test_timer_b));
+    (void)soft_timer_is_active(&test_timer_b , &l_active);
+    TEST_ASSERT_EQUAL(0 , l_active);
+    test_advance(35 , 1);
+    TEST_ASSERT_EQUAL(2 , test_fire_count);
+    TEST_ASSERT_EQUAL('A' , test_fires[0].id);
+    TEST_ASSERT_EQUAL(10 , test_fires[0].tick);
+    TEST_ASSERT_EQUAL('C' , test_fires[1].id);
+    TEST_ASSERT_EQUAL(30 , test_fires[1].tick);
+    /* Stopping a stopped timer is harmless */
+    TEST_ASSERT_EQUAL(E_OK , soft_timer_stop(&test_timer_b));
+}
+
+/* A periodic timer is re-armed from its expiry : processing late does not stretch the period */
+static void test_periodic_rearm_without_drift(void){
+    uint8 l_index = 0;
+    uint8 l_on_time = 1;
+    test_setup(0);
+    (void)soft_timer_create(&test_timer_a , test_callback_a , 7 , SOFT_TIMER_PERIODIC);
+    (void)soft_timer_start(&test_timer_a);
+    /* The main loop only gets around every 5 ticks */
+    test_advance(100 , 5);
+    TEST_ASSERT_EQUAL(14 , test_fire_count);
+    for(l_index = 0 ; l_index < test_fire_count ; l_index++){
+        /* Seen at the first processing not earlier than the expiry */
+        if(test_fires[l_index].tick != (uint16)((((l_index + 1U) * 7U) + 4U) / 5U * 5U)){
+            l_on_time = 0;
+        }
+        else{ /* Nothing */ }
+    }
+    TEST_ASSERT_EQUAL(1 , l_on_time);
+    /* One long gap fires every expiry it covered */
+    test_fire_count = 0;
+    test_advance(70 , 70);
+    TEST_ASSERT_EQUAL(10 , test_fire_count);
+}
+
+/* A one-shot timer restarted from its own callback counts from its expiry */
+static void test_restart_from_callback(void){
+    test_setup(0);
+    (void)soft_timer_create(&test_timer_a , test_callback_restart , 12 , SOFT_TIMER_ONE_SHOT);
+    (void)soft_timer_start(&test_timer_a);
+    test_advance(60 , 1);
+    TEST_ASSERT_EQUAL(5 , test_fire_count);
+    TEST_ASSERT_EQUAL(12 , test_fires[0].tick);
+    TEST_ASSERT_EQUAL(60 , test_fires[4].tick);
+    (void)soft_timer_stop(&test_timer_a);
+}
+
+/* A new period applies from the current expiry on */
+static void test_set_period_keeps_expiry(void){
+    test_setup(0);
+    (void)soft_timer_create(&test_timer_a , test_callback_a , 10 , SOFT_TIMER_PERIODIC);
+    (void)soft_timer_start(&test_timer_a);
+    test_advance(4 , 1);
+    TEST_ASSERT_EQUAL(E_OK , soft_timer_set_period(&test_timer_a , 25));
+    test_advance(56 , 1);
+    TEST_ASSERT_EQUAL(3 , test_fire_count);
+    TEST_ASSERT_EQUAL(10 , test_fires[0].tick);
+    TEST_ASSERT_EQUAL(35 , test_fires[1].tick);
+    TEST_ASSERT_EQUAL(60 , test_fires[2].tick);
+    TEST_ASSERT_EQUAL(E_NOT_OK , soft_timer_set_period(&test_timer_a , 0));
+    (void)soft_timer_stop(&test_timer_a);
+}
+
+/* The 16-bit tick wraps : expiries stay one period apart */
+static void test_tick_wrap(void){
+    test_setup(65530U);
+    (void)soft_timer_create(&test_timer_a , test_callback_a , 10 , SOFT_TIMER_PERIODIC);
+    (void)soft_timer_start(&test_timer_a);
+    test_advance(30 , 1);
+    TEST_ASSERT_EQUAL(3 , test_fire_count);
+    TEST_ASSERT_EQUAL(4 , test_fires[0].tick);
+    TEST_ASSERT_EQUAL(14 , test_fires[1].tick);
+    TEST_ASSERT_EQUAL(24 , test_fires[2].tick);
+    (void)soft_timer_stop(&test_timer_a);
+}
+
+static void test_bad_arguments(void){
+    TEST_ASSERT_EQUAL(E_NOT_OK , soft_timer_create(&test_timer_a , NULL , 10 , SOFT_TIMER_ONE_SHOT));
+    TEST_ASSERT_EQUAL(E_NOT_OK , soft_timer_create(&test_timer_a , test_callback_a , 0 , SOFT_TIMER_ONE_SHOT));
+    TEST_ASSERT_EQUAL(E_NOT_OK , soft_timer_start(NULL));
+}
+
+int main(void){
+    TEST_RUN(test_expiry_order);
+    TEST_RUN(test_equal_expiry_keeps_start_order);
+    TEST_RUN(test_stop_in_the_middle);
+    TEST_RUN(test_periodic_rearm_without_drift);
+    TEST_RUN(test_restart_from_callback);
+    TEST_RUN(test_set_period_keeps_expiry);
+    TEST_RUN(test_tick_wrap);
+    TEST_RUN(test_bad_arguments);
+    return TEST_REPORT();
+}
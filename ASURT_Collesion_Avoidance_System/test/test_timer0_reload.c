@@ -0,0 +1,188 @@
+/* 
+ * File:   test_timer0_reload.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Timer0 tick period jitter and long-term drift : TMR0 counting is modelled in instruction cycles ,
+   TMR0_ISR runs at every overflow after a varied entry latency and its reload is read back */
+
+#include "test_assert.h"
+#include "../MCAL_Layer/Timer0/hal_timer0.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+
+/* The 1 ms scheduler tick : 2000 instruction cycles at 8 MHz */
+#define TEST_PERIOD_CYCLES      2000UL
+#define TEST_TICKS              20000UL
+/* Entry latency of TMR0_ISR in cycles : context save plus a low priority ISR or a critical section in progress */
+#define TEST_LATENCY_MIN        6UL
+#define TEST_LATENCY_MAX        60UL
+/* Cycles from the ISR entry to the TMR0L write of the plain reload */
+#define TEST_OVERWRITE_CYCLES   12UL
+
+typedef struct{
+    uint32 min_interval;            /* shortest time between two ISR entries */
+    uint32 max_interval;
+    uint32 min_overflow;            /* shortest time between two overflows */
+    uint32 max_overflow;
+    uint32 elapsed;                 /* cycles from the first to the last overflow */
+}test_result_t;
+
+static timer0_t test_accumulate_timer = {
+    .TMR0_InterruptHandler = NULL,
+    .priority = INTERRUPT_HIGH_PRIORITY,
+    .operation_mode = TIMER0_TIMER_MODE,
+    .register_size = TIMER0_16BIT_REGISTER_MODE,
+    .prescaler_enable = TIMER0_PRESCALER_DISABLE_CFG,
+    .prescaler_value = TIMER0_PRESCALER_DIV_BY_2,
+    .preload_value = (uint16)(65536UL - TEST_PERIOD_CYCLES)
+};
+
+/* Same period through the prescaler : the ISR falls back to overwriting TMR0 */
+static timer0_t test_overwrite_timer = {
+    .TMR0_InterruptHandler = NULL,
+    .priority = INTERRUPT_HIGH_PRIORITY,
+    .operation_mode = TIMER0_TIMER_MODE,
+    .register_size = TIMER0_16BIT_REGISTER_MODE,
+    .prescaler_enable = TIMER0_PRESCALER_ENABLE_CFG,
+    .prescaler_value = TIMER0_PRESCALER_DIV_BY_2,
+    .preload_value = (uint16)(65536UL - (TEST_PERIOD_CYCLES / 2UL))
+};
+
+static uint32 test_ticks = 0;
+static uint32 test_seed = 1;
+
+void Timer0_DefaultInterruptHandler(void){
+    test_ticks++;
+}
+
+/* Reproducible latency in [TEST_LATENCY_MIN , TEST_LATENCY_MAX] , including both ends */
+static uint32 test_latency(void){
+    test_seed = (test_seed * 1103515245UL) + 12345UL;
+    return TEST_LATENCY_MIN + ((test_seed >> 16) % (TEST_LATENCY_MAX - TEST_LATENCY_MIN + 1UL));
+}
+
+/*
+ * _prescale : instruction cycles per count , the write of TMR0L clears the prescaler
+ * _write_cycles : cycles from the TMR0L read (accumulate) or from the ISR entry (overwrite) to the TMR0L write
+ * After the write the count holds its value 2 cycles before it increments again.
+ */
+static void test_run(uint32 _prescale , uint32 _write_cycles , uint8 _accumulate , test_result_t *_result){
+    uint32 l_overflow = 0;          /* time of the current overflow */
+    uint32 l_first_overflow = 0;
+    uint32 l_entry = 0;
+    uint32 l_last_entry = 0;
+    uint32 l_write = 0;
+    uint32 l_count = 0;
+    uint32 l_next_overflow = 0;
+    uint32 l_tick = 0;
+    uint16 l_reload = 0;
+    _result->min_interval = 0xFFFFFFFFUL;
+    _result->max_interval = 0;
+    _result->min_overflow = 0xFFFFFFFFUL;
+    _result->max_overflow = 0;
+    test_ticks = 0;
+    test_seed = 1;
+    l_overflow = 100000UL;
+    l_first_overflow = l_overflow;
+    for(l_tick = 0 ; l_tick < TEST_TICKS ; l_tick++){
+        l_entry = l_overflow + test_latency();
+        /* Count the ISR finds : the counts since the overflow , TMR0H is latched with TMR0L */
+        l_count = (l_entry - l_overflow) / _prescale;
+        TMR0H = (uint8)(l_count >> 8);
+        TMR0L = (uint8)l_count;
+        INTCONbits.TMR0IF = 1;
+        TMR0_ISR();
+        TEST_ASSERT_EQUAL(0 , INTCONbits.TMR0IF);
+        l_reload = (uint16)(((uint16)TMR0H << 8) | TMR0L);
+        l_write = l_entry + _write_cycles;
+        if(_accumulate){
+            /* The counts found at entry are kept , plus those lost between the read and the write */
+            TEST_ASSERT_EQUAL((uint16)(l_count + (65536UL - TEST_PERIOD_CYCLES) + TIMER0_RELOAD_COMPENSATION_COUNTS) , l_reload);
+        }
+        else{
+            TEST_ASSERT_EQUAL(test_overwrite_timer.preload_value , l_reload);
+        }
+        l_next_overflow = l_write + 2UL + (_prescale * (65536UL - l_reload));
+        if(l_tick > 0){
+            if((l_entry - l_last_entry) < _result->min_interval){
+                _result->min_interval = l_entry - l_last_entry;
+            }
+            else{ /* Nothing */ }
+            if((l_entry - l_last_entry) > _result->max_interval){
+                _result->max_interval = l_entry - l_last_entry;
+            }
+            else{ /* Nothing */ }
+        }
+        else{ /* Nothing */ }
+        if((l_next_overflow - l_overflow) < _result->min_overflow){
+            _result->min_overflow = l_next_overflow - l_overflow;
+        }
+        else{ /* Nothing */ }
+        if((l_next_overflow - l_overflow) > _result->max_overflow){
+            _result->max_overflow = l_next_overflow - l_overflow;
+        }
+        else{ /* Nothing */ }
+        l_last_entry = l_entry;
+        l_overflow = l_next_overflow;
+    }
+    _result->elapsed = l_overflow - l_first_overflow;
+    TEST_ASSERT_EQUAL(TEST_TICKS , test_ticks);
+}
+
+static void test_print(const char *_name , const test_result_t *_result){
+    long l_drift = (long)_result->elapsed - (long)(TEST_TICKS * TEST_PERIOD_CYCLES);
+    printf("    %s : mean period %lu.%03lu cycles , drift %ld cycles (%ld ppm) , entry interval %lu..%lu cycles\n" ,
+           _name , (unsigned long)(_result->elapsed / TEST_TICKS) ,
+           (unsigned long)(((_result->elapsed % TEST_TICKS) * 1000UL) / TEST_TICKS) ,
+           l_drift , (l_drift * 1000000L) / (long)(TEST_TICKS * TEST_PERIOD_CYCLES) ,
+           (unsigned long)_result->min_interval , (unsigned long)_result->max_interval);
+}
+
+/* Accumulate reload : every overflow is exactly one period after the previous one , whatever the latency */
+static void test_accumulate_has_no_drift(void){
+    test_result_t l_result;
+    pic_stub_reset();
+    TEST_ASSERT_EQUAL(E_OK , timer0_initialize(&test_accumulate_timer));
+    test_run(1UL , TIMER0_RELOAD_COMPENSATION_COUNTS - 2UL , 1 , &l_result);
+    test_print("accumulate reload" , &l_result);
+    TEST_ASSERT_EQUAL(TEST_TICKS * TEST_PERIOD_CYCLES , l_result.elapsed);
+    TEST_ASSERT_EQUAL(TEST_PERIOD_CYCLES , l_result.min_overflow);
+    TEST_ASSERT_EQUAL(TEST_PERIOD_CYCLES , l_result.max_overflow);
+    /* The tick seen by the software only jitters by the latency spread */
+    TEST_ASSERT(l_result.min_interval >= (TEST_PERIOD_CYCLES - (TEST_LATENCY_MAX - TEST_LATENCY_MIN)));
+    TEST_ASSERT(l_result.max_interval <= (TEST_PERIOD_CYCLES + (TEST_LATENCY_MAX - TEST_LATENCY_MIN)));
+    TEST_ASSERT(l_result.min_interval < TEST_PERIOD_CYCLES);
+    TEST_ASSERT(l_result.max_interval > TEST_PERIOD_CYCLES);
+}
+
+/* A compensation that does not match the ISR code gives a fixed error per period , never a random one */
+static void test_compensation_error_is_constant(void){
+    test_result_t l_result;
+    pic_stub_reset();
+    TEST_ASSERT_EQUAL(E_OK , timer0_initialize(&test_accumulate_timer));
+    test_run(1UL , TIMER0_RELOAD_COMPENSATION_COUNTS - 2UL + 1UL , 1 , &l_result);
+    test_print("compensation one count short" , &l_result);
+    TEST_ASSERT_EQUAL(TEST_PERIOD_CYCLES + 1UL , l_result.min_overflow);
+    TEST_ASSERT_EQUAL(TEST_PERIOD_CYCLES + 1UL , l_result.max_overflow);
+}
+
+/* Overwrite reload : the latency and the write delay are added to every period */
+static void test_overwrite_drifts(void){
+    test_result_t l_result;
+    pic_stub_reset();
+    TEST_ASSERT_EQUAL(E_OK , timer0_initialize(&test_overwrite_timer));
+    test_run(2UL , TEST_OVERWRITE_CYCLES , 0 , &l_result);
+    test_print("overwrite reload" , &l_result);
+    TEST_ASSERT(l_result.elapsed >= (TEST_TICKS * (TEST_PERIOD_CYCLES + TEST_LATENCY_MIN + TEST_OVERWRITE_CYCLES + 2UL)));
+    TEST_ASSERT(l_result.elapsed <= (TEST_TICKS * (TEST_PERIOD_CYCLES + TEST_LATENCY_MAX + TEST_OVERWRITE_CYCLES + 2UL)));
+    TEST_ASSERT(l_result.max_overflow > l_result.min_overflow);
+}
+
+int main(void){
+    TEST_RUN(test_accumulate_has_no_drift);
+    TEST_RUN(test_compensation_error_is_constant);
+    TEST_RUN(test_overwrite_drifts);
+    return TEST_REPORT();
+}
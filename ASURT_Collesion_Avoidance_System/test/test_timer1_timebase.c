@@ -0,0 +1,237 @@
+/* 
+ * File:   test_timer1_timebase.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* 32-bit microsecond timebase : Timer1 overflows raised between the reads of time_now_us() ,
+   with the overflow interrupt free to run and masked by the caller */
+
+#include "test_assert.h"
+#include "../MCAL_Layer/Timer1/hal_timer1.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+
+static timer1_t test_timer = {
+    .TMR1_InterruptHandler = NULL,
+    .priority = INTERRUPT_LOW_PRIORITY,
+    .operation_mode = TIMER1_TIMER_MODE,
+    .counter_mode = TIMER1_SYNC_COUNTER_MODE,
+    .oscillator_cfg = TIMER1_OSCILLATOR_DISABLE,
+    .register_size = TIMER1_16BIT_REGISTER_MODE,
+    .prescaler_value = TIMER1_PRESCALER_DIV_BY_2,
+    .preload_value = 0
+};
+
+static uint32 test_time = 0;        /* true time , the Timer1 count with its overflows */
+static uint32 test_step_low = 0;    /* us elapsing before the TMR1L read */
+static uint32 test_step_high = 0;   /* us elapsing between the TMR1L read and the TMR1H read */
+static uint8 test_isr_enabled = 1;  /* 0 : the caller masks the Timer1 interrupt */
+static uint32 test_read_time = 0;   /* true time at the last TMR1L read */
+static uint32 test_seed = 1;
+
+/* Time passes : a count wrap raises TMR1IF , the ISR runs at once unless masked */
+static void test_advance(uint32 _us){
+    uint32 l_before = test_time;
+    test_time += _us;
+    if((l_before >> 16) != (test_time >> 16)){
+        PIR1bits.TMR1IF = 1;
+        if(test_isr_enabled){
+            TMR1_ISR();
+        }
+        else{ /* Nothing */ }
+    }
+    else{ /* Nothing */ }
+}
+
+/* Reading TMR1L latches the high byte into the TMR1H buffer (16-bit read mode) */
+static void test_tmr1_hook(unsigned char _high_byte){
+    if(0 == _high_byte){
+        test_advance(test_step_low);
+        test_read_time = test_time;
+        TMR1L = (uint8)test_time;
+        TMR1H = (uint8)(test_time >> 8);
+    }
+    else{
+        test_advance(test_step_high);
+    }
+}
+
+/* Timebase at (_overflows << 16) , no overflow pending */
+static void test_setup(uint16 _overflows){
+    uint32 l_index = 0;
+    pic_stub_reset();
+    INTCONbits.GIEH = 1;
+    TEST_ASSERT_EQUAL(E_OK , timer1_initialize(&test_timer));
+    for(l_index = 0 ; l_index < _overflows ; l_index++){
+        PIR1bits.TMR1IF = 1;
+        TMR1_ISR();
+    }
+    test_time = (uint32)_overflows << 16;
+    test_isr_enabled = 1;
+    test_step_low = 0;
+    test_step_high = 0;
+    pic_stub_tmr1_hook = test_tmr1_hook;
+}
+
+static uint32 test_read(void){
+    uint32 l_now = 0;
+    TEST_ASSERT_EQUAL(E_OK , time_now_us(&l_now));
+    return l_now;
+}
+
+/* The caller unmasks : a pending overflow is serviced */
+static void test_unmask(void){
+    test_isr_enabled = 1;
+    if(PIR1bits.TMR1IF){
+        TMR1_ISR();
+    }
+    else{ /* Nothing */ }
+}
+
+/* Count read just below the wrap , the ISR runs before the flag check : the read is retried */
+static void test_overflow_serviced_during_read(void){
+    uint32 l_before = 0;
+    uint32 l_now = 0;
+    test_setup(5);
+    test_time = (5UL << 16) | 0xFFF0UL;
+    l_before = test_read();
+    test_step_high = 0x20;
+    l_now = test_read();
+    TEST_ASSERT_EQUAL(test_read_time , l_now);
+    TEST_ASSERT_EQUAL((6UL << 16) | 0x10UL , l_now);
+    TEST_ASSERT(l_now > l_before);
+    TEST_ASSERT_EQUAL(0 , PIR1bits.TMR1IF);
+}
+
+/* Masked , the overflow happens between the count read and the flag check at counts of 0x8000 and above :
+   the pending flag belongs to a later wrap and is not counted */
+static void test_masked_overflow_after_read(void){
+    static const uint16 l_counts[] = {0x8000U , 0x9000U , 0xC000U , 0xFFF0U , 0xFFFFU};
+    uint32 l_before = 0;
+    uint32 l_now = 0;
+    uint32 l_after = 0;
+    uint8 l_index = 0;
+    for(l_index = 0 ; l_index < (sizeof(l_counts) / sizeof(l_counts[0])) ; l_index++){
+        test_setup(7);
+        test_time = (7UL << 16) | l_counts[l_index];
+        l_before = test_read();
+        test_step_high = 0x10000UL - l_counts[l_index];
+        test_isr_enabled = 0;
+        l_now = test_read();
+        TEST_ASSERT_EQUAL(1 , PIR1bits.TMR1IF);
+        TEST_ASSERT_EQUAL(test_read_time , l_now);
+        TEST_ASSERT_EQUAL((7UL << 16) | l_counts[l_index] , l_now);
+        TEST_ASSERT(l_now >= l_before);
+        test_unmask();
+        test_step_high = 0;
+        l_after = test_read();
+        TEST_ASSERT_EQUAL(8UL , l_after >> 16);
+        TEST_ASSERT(l_after > l_now);
+    }
+}
+
+/* Masked , the overflow happened before the count read and is still pending at counts below 0x8000 :
+   it is added to the result */
+static void test_masked_overflow_before_read(void){
+    static const uint16 l_counts[] = {0x0000U , 0x0001U , 0x0100U , 0x4000U , 0x7FFFU};
+    uint32 l_before = 0;
+    uint32 l_now = 0;
+    uint32 l_after = 0;
+    uint8 l_index = 0;
+    for(l_index = 0 ; l_index < (sizeof(l_counts) / sizeof(l_counts[0])) ; l_index++){
+        test_setup(9);
+        test_time = (9UL << 16) | 0xFFF0UL;
+        l_before = test_read();
+        test_isr_enabled = 0;
+        test_step_low = 0x10UL + l_counts[l_index];
+        l_now = test_read();
+        TEST_ASSERT_EQUAL(1 , PIR1bits.TMR1IF);
+        TEST_ASSERT_EQUAL(test_read_time , l_now);
+        TEST_ASSERT_EQUAL((10UL << 16) | l_counts[l_index] , l_now);
+        TEST_ASSERT(l_now > l_before);
+        test_unmask();
+        test_step_low = 0;
+        l_after = test_read();
+        TEST_ASSERT_EQUAL(l_now , l_after);
+    }
+}
+
+/* The overflow count is updated with the high priority interrupts masked , and GIEH is restored */
+static void test_isr_restores_gieh(void){
+    uint32 l_now = 0;
+    test_setup(0);
+    pic_stub_tmr1_hook = NULL;
+    INTCONbits.GIEH = 1;
+    PIR1bits.TMR1IF = 1;
+    TMR1_ISR();
+    TEST_ASSERT_EQUAL(1 , INTCONbits.GIEH);
+    TEST_ASSERT_EQUAL(0 , PIR1bits.TMR1IF);
+    INTCONbits.GIEH = 0;
+    PIR1bits.TMR1IF = 1;
+    TMR1_ISR();
+    TEST_ASSERT_EQUAL(0 , INTCONbits.GIEH);
+    TEST_ASSERT_EQUAL(0 , PIR1bits.TMR1IF);
+    TMR1L = 0;
+    TMR1H = 0;
+    (void)time_now_us(&l_now);
+    TEST_ASSERT_EQUAL(2UL << 16 , l_now);
+    TEST_ASSERT_EQUAL(E_NOT_OK , time_now_us(NULL));
+}
+
+static uint32 test_random(uint32 _range){
+    test_seed = (test_seed * 1103515245UL) + 12345UL;
+    return (test_seed >> 8) % _range;
+}
+
+/* Random read timings and masking across thousands of wraps and the 32-bit wrap : every result is
+   the true time of its TMR1L read and the timebase never goes back (modulo 2^32) */
+static void test_monotonic_sweep(void){
+    uint32 l_read = 0;
+    uint32 l_now = 0;
+    uint32 l_last = 0;
+    uint32 l_errors = 0;
+    uint32 l_backwards = 0;
+    test_setup(0xFF00U);
+    test_seed = 1;
+    l_last = test_read();
+    for(l_read = 0 ; l_read < 300000UL ; l_read++){
+        test_step_low = 0;
+        test_step_high = 0;
+        test_advance(test_random(3000));
+        /* Land near a wrap one time in four */
+        if(0 == test_random(4)){
+            test_advance((0x10000UL - (test_time & 0xFFFFUL) - 20UL) & 0xFFFFUL);
+        }
+        else{ /* Nothing */ }
+        test_step_low = test_random(40);
+        test_step_high = test_random(40);
+        test_isr_enabled = (uint8)(0 != test_random(2));
+        l_now = test_read();
+        test_unmask();
+        if(l_now != test_read_time){
+            l_errors++;
+        }
+        else{ /* Nothing */ }
+        if((uint32)(l_now - l_last) >= 0x80000000UL){
+            l_backwards++;
+        }
+        else{ /* Nothing */ }
+        l_last = l_now;
+    }
+    printf("    %lu reads up to %08lX us , %lu wrong , %lu going back\n" , (unsigned long)l_read ,
+           (unsigned long)test_time , (unsigned long)l_errors , (unsigned long)l_backwards);
+    TEST_ASSERT_EQUAL(0 , l_errors);
+    TEST_ASSERT_EQUAL(0 , l_backwards);
+    /* The run went through the 32-bit wrap */
+    TEST_ASSERT(test_time < 0xFF000000UL);
+}
+
+int main(void){
+    TEST_RUN(test_overflow_serviced_during_read);
+    TEST_RUN(test_masked_overflow_after_read);
+    TEST_RUN(test_masked_overflow_before_read);
+    TEST_RUN(test_isr_restores_gieh);
+    TEST_RUN(test_monotonic_sweep);
+    return TEST_REPORT();
+}
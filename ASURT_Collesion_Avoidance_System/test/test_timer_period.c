@@ -0,0 +1,231 @@
+/* 
+ * File:   test_timer_period.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Period in microseconds of Timer0 and Timer2 : prescaler , preload , PR2 and postscaler selection ,
+   the TIMER0_PERIOD_* compile-time macros against timer0_set_period_us() */
+
+#include "test_assert.h"
+#include "../MCAL_Layer/Timer0/hal_timer0.h"
+#include "../MCAL_Layer/Timer2/hal_timer2.h"
+#include "../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+
+static timer0_t test_timer0 = {
+    .TMR0_InterruptHandler = NULL,
+    .priority = INTERRUPT_HIGH_PRIORITY,
+    .operation_mode = TIMER0_TIMER_MODE,
+    .register_size = TIMER0_16BIT_REGISTER_MODE,
+    .prescaler_enable = TIMER0_PRESCALER_DISABLE_CFG,
+    .prescaler_value = TIMER0_PRESCALER_DIV_BY_2,
+    .preload_value = 0
+};
+
+static timer2_t test_timer2 = {
+    .TMR2_InterruptHandler = NULL,
+    .priority = INTERRUPT_LOW_PRIORITY,
+    .timer2_prescaler = TIMER2_PRESCALER_DIV_BY_1,
+    .timer2_postscaler = TIMER2_POSTSCALER_DIV_BY_1,
+    .timer2_preload_value = 0,
+};
+
+/* Division by the Timer2 pre-scaler , indexed by T2CKPS */
+void Timer0_DefaultInterruptHandler(void){
+}
+
+static const uint32 test_timer2_prescaler_div[3] = {1UL , 4UL , 16UL};
+
+static uint16 test_timer0_preload(void){
+    uint8 l_low = TMR0L;
+    return (uint16)(((uint16)TMR0H << 8) | l_low);
+}
+
+/* Timer0 counts per prescaler input , 1 when the prescaler is bypassed */
+static uint32 test_timer0_prescale(void){
+    return (1U == T0CONbits.PSA) ? 1UL : (2UL << T0CONbits.T0PS);
+}
+
+/* The 1 ms scheduler tick : no prescaler , 2000 counts */
+static void test_timer0_scheduler_period(void){
+    TEST_ASSERT_EQUAL(E_OK , timer0_set_period_us(&test_timer0 , 1000UL));
+    TEST_ASSERT_EQUAL(1 , T0CONbits.PSA);
+    TEST_ASSERT_EQUAL(63536U , test_timer0_preload());
+    TEST_ASSERT_EQUAL(1 , T0CONbits.TMR0ON);
+    TEST_ASSERT_EQUAL(63536U , TIMER0_PERIOD_PRELOAD(1000UL));
+    TEST_ASSERT_EQUAL(TIMER0_PRESCALER_DISABLE_CFG , TIMER0_PERIOD_PRESCALER_ENABLE(1000UL));
+}
+
+/* The compile-time macros select what the runtime function selects , within half a count of the period */
+static void test_timer0_macros_match_runtime(void){
+    static const uint32 l_periods[] = {1UL , 2UL , 100UL , 999UL , 1000UL , 32767UL , 32768UL , 32769UL ,
+                                       50000UL , 65535UL , 65536UL , 100000UL , 1000000UL , 4194303UL ,
+                                       TIMER0_PERIOD_MAX_US};
+    uint8 l_index = 0;
+    uint32 l_period = 0;
+    uint32 l_prescale = 0;
+    uint32 l_cycles = 0;
+    uint32 l_actual = 0;
+    for(l_index = 0 ; l_index < (sizeof(l_periods) / sizeof(l_periods[0])) ; l_index++){
+        l_period = l_periods[l_index];
+        TEST_ASSERT_EQUAL(1 , TIMER0_PERIOD_IN_RANGE(l_period));
+        TEST_ASSERT_EQUAL(E_OK , timer0_set_period_us(&test_timer0 , l_period));
+        l_prescale = test_timer0_prescale();
+        TEST_ASSERT_EQUAL(TIMER0_PERIOD_PRESCALE(l_period) , l_prescale);
+        TEST_ASSERT_EQUAL((1UL == l_prescale) ? TIMER0_PRESCALER_DISABLE_CFG : TIMER0_PRESCALER_ENABLE_CFG ,
+                          TIMER0_PERIOD_PRESCALER_ENABLE(l_period));
+        if(1UL != l_prescale){
+            TEST_ASSERT_EQUAL(TIMER0_PERIOD_PRESCALER_VALUE(l_period) , T0CONbits.T0PS);
+        }
+        else{ /* Nothing */ }
+        TEST_ASSERT_EQUAL(TIMER0_PERIOD_PRELOAD(l_period) , test_timer0_preload());
+        /* Smallest prescaler : half of it would not fit */
+        l_cycles = TIMER0_PERIOD_CYCLES(l_period);
+        if(1UL != l_prescale){
+            TEST_ASSERT(l_cycles > (65536UL * (l_prescale / 2UL)));
+        }
+        else{ /* Nothing */ }
+        l_actual = (65536UL - test_timer0_preload()) * l_prescale;
+        if(0U == test_timer0_preload()){
+            l_actual = 65536UL * l_prescale;
+        }
+        else{ /* Nothing */ }
+        TEST_ASSERT(((l_actual > l_cycles) ? (l_actual - l_cycles) : (l_cycles - l_actual)) <= (l_prescale / 2UL));
+    }
+}
+
+/* The longest period uses the whole 16-bit count with the 1:256 prescaler , one microsecond more is rejected */
+static void test_timer0_range_limits(void){
+    TEST_ASSERT_EQUAL(E_OK , timer0_set_period_us(&test_timer0 , TIMER0_PERIOD_MAX_US));
+    TEST_ASSERT_EQUAL(0 , T0CONbits.PSA);
+    TEST_ASSERT_EQUAL(TIMER0_PRESCALER_DIV_BY_256 , T0CONbits.T0PS);
+    TEST_ASSERT_EQUAL(0 , test_timer0_preload());
+    TEST_ASSERT_EQUAL(0 , TIMER0_PERIOD_IN_RANGE(TIMER0_PERIOD_MAX_US + 1UL));
+    /* A rejected period leaves the running configuration alone */
+    TEST_ASSERT_EQUAL(E_OK , timer0_set_period_us(&test_timer0 , 1000UL));
+    TEST_ASSERT_EQUAL(E_NOT_OK , timer0_set_period_us(&test_timer0 , TIMER0_PERIOD_MAX_US + 1UL));
+    TEST_ASSERT_EQUAL(E_NOT_OK , timer0_set_period_us(&test_timer0 , 0UL));
+    TEST_ASSERT_EQUAL(E_NOT_OK , timer0_set_period_us(NULL , 1000UL));
+    TEST_ASSERT_EQUAL(1 , T0CONbits.PSA);
+    TEST_ASSERT_EQUAL(63536U , test_timer0_preload());
+    test_timer0.operation_mode = TIMER0_COUNTER_MODE;
+    TEST_ASSERT_EQUAL(E_NOT_OK , timer0_set_period_us(&test_timer0 , 1000UL));
+    test_timer0.operation_mode = TIMER0_TIMER_MODE;
+}
+
+/* 8-bit register : 256 counts per prescaler input , the preload is in TMR0L */
+static void test_timer0_8bit_mode(void){
+    test_timer0.register_size = TIMER0_8BIT_REGISTER_MODE;
+    TEST_ASSERT_EQUAL(E_OK , timer0_set_period_us(&test_timer0 , 100UL));
+    TEST_ASSERT_EQUAL(1 , T0CONbits.PSA);
+    TEST_ASSERT_EQUAL(56 , TMR0L);
+    TEST_ASSERT_EQUAL(E_OK , timer0_set_period_us(&test_timer0 , 1000UL));
+    TEST_ASSERT_EQUAL(0 , T0CONbits.PSA);
+    TEST_ASSERT_EQUAL(TIMER0_PRESCALER_DIV_BY_8 , T0CONbits.T0PS);
+    TEST_ASSERT_EQUAL(6 , TMR0L);
+    /* 256 counts of 1:256 */
+    TEST_ASSERT_EQUAL(E_OK , timer0_set_period_us(&test_timer0 , 32768UL));
+    TEST_ASSERT_EQUAL(TIMER0_PRESCALER_DIV_BY_256 , T0CONbits.T0PS);
+    TEST_ASSERT_EQUAL(0 , TMR0L);
+    TEST_ASSERT_EQUAL(E_NOT_OK , timer0_set_period_us(&test_timer0 , 32769UL));
+    test_timer0.register_size = TIMER0_16BIT_REGISTER_MODE;
+}
+
+/* Smallest error of any pre-scaler , post-scaler and PR2 , and the smallest pre-scaler reaching it */
+static uint32 test_timer2_best_error(uint32 _cycles , uint8 *_prescaler){
+    uint32 l_best = 0xFFFFFFFFUL;
+    uint32 l_actual = 0;
+    uint32 l_error = 0;
+    uint8 l_pre = 0;
+    uint32 l_post = 0;
+    uint32 l_counts = 0;
+    for(l_pre = 0 ; l_pre < 3U ; l_pre++){
+        for(l_post = 1 ; l_post <= 16UL ; l_post++){
+            for(l_counts = 1 ; l_counts <= 256UL ; l_counts++){
+                l_actual = l_counts * test_timer2_prescaler_div[l_pre] * l_post;
+                l_error = (l_actual > _cycles) ? (l_actual - _cycles) : (_cycles - l_actual);
+                if(l_error < l_best){
+                    l_best = l_error;
+                    *_prescaler = l_pre;
+                }
+                else{ /* Nothing */ }
+            }
+        }
+    }
+    return l_best;
+}
+
+/* Error of the configuration Timer2_Set_Period_us() left in the registers */
+static uint32 test_timer2_error(uint32 _cycles){
+    uint32 l_actual = ((uint32)PR2 + 1UL) * test_timer2_prescaler_div[T2CONbits.T2CKPS] * ((uint32)T2CONbits.TOUTPS + 1UL);
+    return (l_actual > _cycles) ? (l_actual - _cycles) : (_cycles - l_actual);
+}
+
+static void test_timer2_period_table(void){
+    static const uint32 l_periods[] = {1UL , 2UL , 3UL , 50UL , 100UL , 128UL , 129UL , 250UL , 500UL , 997UL ,
+                                       1000UL , 1234UL , 2000UL , 4096UL , 5000UL , 10000UL , 16383UL ,
+                                       20000UL , 25000UL , 32767UL , TIMER2_PERIOD_MAX_US};
+    uint8 l_index = 0;
+    uint8 l_best_prescaler = 0;
+    uint32 l_cycles = 0;
+    uint32 l_best = 0;
+    uint32 l_pre = 0;
+    uint32 l_post = 0;
+    for(l_index = 0 ; l_index < (sizeof(l_periods) / sizeof(l_periods[0])) ; l_index++){
+        l_cycles = TIMER2_PERIOD_CYCLES(l_periods[l_index]);
+        TEST_ASSERT_EQUAL(E_OK , Timer2_Set_Period_us(&test_timer2 , l_periods[l_index]));
+        l_best = test_timer2_best_error(l_cycles , &l_best_prescaler);
+        TEST_ASSERT_EQUAL(l_best , test_timer2_error(l_cycles));
+        /* On equal error the finest PWM resolution (smallest pre-scaler) */
+        TEST_ASSERT_EQUAL(l_best_prescaler , T2CONbits.T2CKPS);
+        /* The compile-time helpers give the same PR2 for the selected scalers */
+        l_pre = test_timer2_prescaler_div[T2CONbits.T2CKPS];
+        l_post = (uint32)T2CONbits.TOUTPS + 1UL;
+        TEST_ASSERT_EQUAL(1 , TIMER2_PERIOD_IN_RANGE(l_periods[l_index] , l_pre , l_post));
+        TEST_ASSERT_EQUAL(TIMER2_PERIOD_PR2(l_periods[l_index] , l_pre , l_post) , PR2);
+        TEST_ASSERT_EQUAL(0 , TMR2);
+        TEST_ASSERT_EQUAL(1 , T2CONbits.TMR2ON);
+        printf("    %6lu us : PR2 %3u , 1:%-2lu , 1:%-2lu , error %lu cycles\n" , (unsigned long)l_periods[l_index] ,
+               PR2 , (unsigned long)l_pre , (unsigned long)l_post , (unsigned long)test_timer2_error(l_cycles));
+    }
+}
+
+/* Every period up to TIMER2_PERIOD_MAX_US reaches the smallest possible error */
+static void test_timer2_all_periods(void){
+    uint32 l_period = 0;
+    uint32 l_worse = 0;
+    uint8 l_best_prescaler = 0;
+    for(l_period = 1 ; l_period <= TIMER2_PERIOD_MAX_US ; l_period++){
+        if((E_OK != Timer2_Set_Period_us(&test_timer2 , l_period)) ||
+           (test_timer2_best_error(TIMER2_PERIOD_CYCLES(l_period) , &l_best_prescaler) != test_timer2_error(TIMER2_PERIOD_CYCLES(l_period)))){
+            l_worse++;
+        }
+        else{ /* Nothing */ }
+    }
+    TEST_ASSERT_EQUAL(0 , l_worse);
+}
+
+static void test_timer2_range_limits(void){
+    TEST_ASSERT_EQUAL(E_OK , Timer2_Set_Period_us(&test_timer2 , TIMER2_PERIOD_MAX_US));
+    TEST_ASSERT_EQUAL(255 , PR2);
+    TEST_ASSERT_EQUAL(TIMER2_PRESCALER_DIV_BY_16 , T2CONbits.T2CKPS);
+    TEST_ASSERT_EQUAL(TIMER2_POSTSCALER_DIV_BY_16 , T2CONbits.TOUTPS);
+    TEST_ASSERT_EQUAL(E_OK , Timer2_Set_Period_us(&test_timer2 , 1000UL));
+    TEST_ASSERT_EQUAL(E_NOT_OK , Timer2_Set_Period_us(&test_timer2 , TIMER2_PERIOD_MAX_US + 1UL));
+    TEST_ASSERT_EQUAL(E_NOT_OK , Timer2_Set_Period_us(&test_timer2 , 0UL));
+    TEST_ASSERT_EQUAL(E_NOT_OK , Timer2_Set_Period_us(NULL , 1000UL));
+    TEST_ASSERT_EQUAL(0 , test_timer2_error(TIMER2_PERIOD_CYCLES(1000UL)));
+}
+
+int main(void){
+    pic_stub_reset();
+    TEST_RUN(test_timer0_scheduler_period);
+    TEST_RUN(test_timer0_macros_match_runtime);
+    TEST_RUN(test_timer0_range_limits);
+    TEST_RUN(test_timer0_8bit_mode);
+    TEST_RUN(test_timer2_period_table);
+    TEST_RUN(test_timer2_all_periods);
+    TEST_RUN(test_timer2_range_limits);
+    return TEST_REPORT();
+}
@@ -0,0 +1,232 @@
+/* 
+ * File:   test_ttc_estimator.c
+ * Author: Omar Mohamed Fathy
+ * Submitted to : ASU Racing Team
+ * Created on October 18, 2026, 08:30 PM
+ */
+
+/* Time-to-collision tracker replayed over approach profiles : one distance (cm) per 50 ms frame ,
+   rounded to the cm with a +-1 cm jitter like the ultrasonic ranger. The profiles are synthesised in
+   that format , no bench capture is stored in the tree yet : a recorded run replaces a table as is */
+
+#include "test_assert.h"
+#include "../ECU_Layer/TTC_Estimator/ecu_ttc_estimator.h"
+
+#define TEST_FRAME_PERIOD_US        50000UL
+#define TEST_MAX_SAMPLES            128U
+/* Samples the tracker is given to converge before its estimates are checked */
+#define TEST_SETTLE_SAMPLES         10U
+
+/* 100 cm/s constant approach from 3 m */
+static const uint16 test_profile_constant[] = {
+    300 , 295 , 291 , 284 , 279 , 274 , 270 , 264 , 260 , 254 , 249 , 246 , 241 , 234 , 230 ,
+    224 , 221 , 214 , 209 , 205 , 199 , 196 , 189 , 185 , 179 , 175 , 170 , 166 , 160 , 154 ,
+    150 , 145 , 139 , 135 , 130 , 124 , 119 , 114 , 110 , 106 , 101 ,  95 ,  91 ,  86 ,  80 ,
+     75 ,  70 ,  65 ,  60 ,  54 ,  50 ,  46 ,  40 ,  36 ,  30 ,  24 ,  19 ,  16
+};
+
+/* 250 cm/s approach from 5 m braking to a stop at 40 cm */
+static const uint16 test_profile_braking[] = {
+    500 , 488 , 475 , 464 , 452 , 439 , 427 , 417 , 405 , 394 , 384 , 374 , 361 , 351 , 342 ,
+    333 , 321 , 311 , 303 , 294 , 284 , 276 , 266 , 256 , 250 , 241 , 232 , 223 , 218 , 208 ,
+    201 , 194 , 187 , 180 , 174 , 168 , 161 , 153 , 148 , 143 , 137 , 130 , 125 , 121 , 114 ,
+    110 , 105 , 101 ,  96 ,  91 ,  86 ,  83 ,  80 ,  76 ,  73 ,  68 ,  67 ,  63 ,  61 ,  58 ,
+     55 ,  53 ,  52 ,  50 ,  48 ,  46 ,  44 ,  45 ,  44 ,  43 ,  42 ,  42 ,  39 ,  41 ,  41 ,
+     39 ,  40 ,  39 ,  40 ,  41
+};
+
+/* Obstacle standing at 80 cm , +-2 cm jitter */
+static const uint16 test_profile_stationary[] = {
+     79 ,  78 ,  80 ,  81 ,  78 ,  78 ,  78 ,  81 ,  79 ,  81 ,  78 ,  80 ,  81 ,  78 ,  78 ,
+     79 ,  81 ,  80 ,  79 ,  82 ,  80 ,  80 ,  81 ,  80 ,  80 ,  78 ,  78 ,  80 ,  80 ,  80 ,
+     80 ,  80 ,  78 ,  79 ,  78 ,  82 ,  80 ,  82 ,  80 ,  80 ,  82 ,  79 ,  81 ,  78 ,  79 ,
+     81 ,  80 ,  79 ,  82 ,  81 ,  78 ,  81 ,  80 ,  82 ,  78 ,  82 ,  80 ,  81 ,  80 ,  79
+};
+
+/* Obstacle moving away at 60 cm/s */
+static const uint16 test_profile_receding[] = {
+     50 ,  53 ,  56 ,  59 ,  62 ,  65 ,  69 ,  71 ,  74 ,  78 ,  80 ,  82 ,  85 ,  89 ,  93 ,
+     95 ,  98 , 101 , 105 , 107 , 110 , 112 , 116 , 118 , 122 , 126 , 128 , 131 , 134 , 138 ,
+    139 , 144 , 146 , 148 , 151 , 156 , 158 , 162 , 164 , 168 , 170 , 172 , 177 , 180 , 183 ,
+    184 , 188 , 191 , 194 , 196
+};
+
+/* 400 cm/s approach from 9 m */
+static const uint16 test_profile_fast[] = {
+    900 , 881 , 860 , 841 , 820 , 800 , 780 , 759 , 739 , 719 , 700 , 681 , 660 , 640 , 619 ,
+    600 , 580 , 560 , 540 , 520 , 500 , 481 , 460 , 439 , 420 , 401 , 381 , 360 , 340 , 319 ,
+    301 , 280 , 259 , 240 , 220 , 200 , 181 , 159 , 139 , 120 , 101 ,  79 ,  59 ,  40 ,  20
+};
+
+static uint16 test_ttc[TEST_MAX_SAMPLES];
+static sint16 test_speed[TEST_MAX_SAMPLES];
+
+/* Replays a profile from a timestamp close to the 32-bit wrap of the microsecond timebase */
+static void test_replay(ttc_estimator_t *_estimator , const uint16 *_profile , uint8 _count){
+    uint32 l_timestamp_us = 0xFFFFFFFFUL - 400000UL;
+    uint8 l_index = 0;
+    (void)ttc_estimator_reset(_estimator);
+    for(l_index = 0 ; l_index < _count ; l_index++){
+        (void)ttc_estimator_update(_estimator , _profile[l_index] , l_timestamp_us , &test_ttc[l_index]);
+        (void)ttc_estimator_get_closing_speed(_estimator , &test_speed[l_index]);
+        l_timestamp_us += TEST_FRAME_PERIOD_US;
+    }
+}
+
+#define TEST_COUNT(_profile)    ((uint8)(sizeof(_profile) / sizeof(_profile[0])))
+
+/* After settling the closing speed is within 15 cm/s of 100 cm/s and the time-to-collision within
+   20 % (+ one frame) of distance / speed , down to 20 cm */
+static void test_constant_approach(void){
+    ttc_estimator_t l_estimator;
+    uint8 l_index = 0;
+    uint32 l_expected_ms = 0;
+    uint32 l_error_ms = 0;
+    uint8 l_speed_ok = 1;
+    uint8 l_ttc_ok = 1;
+    test_replay(&l_estimator , test_profile_constant , TEST_COUNT(test_profile_constant));
+    for(l_index = TEST_SETTLE_SAMPLES ; l_index < TEST_COUNT(test_profile_constant) ; l_index++){
+        if((test_speed[l_index] < 85) || (test_speed[l_index] > 115)){
+            l_speed_ok = 0;
+        }
+        else{ /* Nothing */ }
+        if(test_profile_constant[l_index] >= 20U){
+            l_expected_ms = (uint32)test_profile_constant[l_index] * 10UL;
+            l_error_ms = (test_ttc[l_index] > l_expected_ms) ? (test_ttc[l_index] - l_expected_ms) : (l_expected_ms - test_ttc[l_index]);
+            if(l_error_ms > ((l_expected_ms / 5UL) + 50UL)){
+                printf("    %u cm : %u ms , expected %lu ms\n" , test_profile_constant[l_index] , test_ttc[l_index] , (unsigned long)l_expected_ms);
+                l_ttc_ok = 0;
+            }
+            else{ /* Nothing */ }
+        }
+        else{ /* Nothing */ }
+    }
+    TEST_ASSERT_EQUAL(1 , l_speed_ok);
+    TEST_ASSERT_EQUAL(1 , l_ttc_ok);
+    /* The first sample has no speed yet */
+    TEST_ASSERT_EQUAL(TTC_ESTIMATOR_NONE , test_ttc[0]);
+}
+
+/* Braking to a stop : the time-to-collision grows back to none once the obstacle stands still */
+static void test_braking_approach(void){
+    ttc_estimator_t l_estimator;
+    uint8 l_count = TEST_COUNT(test_profile_braking);
+    uint8 l_index = 0;
+    uint16 l_min_ttc = TTC_ESTIMATOR_NONE;
+    test_replay(&l_estimator , test_profile_braking , l_count);
+    for(l_index = TEST_SETTLE_SAMPLES ; l_index < l_count ; l_index++){
+        if(test_ttc[l_index] < l_min_ttc){
+            l_min_ttc = test_ttc[l_index];
+        }
+        else{ /* Nothing */ }
+    }
+    /* Closing at 250 cm/s from 5 m : a collision course about 2 s ahead at first */
+    TEST_ASSERT(test_ttc[TEST_SETTLE_SAMPLES] < 2500U);
+    /* Closest to a collision near 80 cm , about 1.1 s ahead at the true speed : the tracker lag may
+       shorten it a little but not into a false 0.5 s alarm */
+    printf("    shortest time-to-collision %u ms\n" , l_min_ttc);
+    TEST_ASSERT(l_min_ttc > 800U);
+    TEST_ASSERT_EQUAL(TTC_ESTIMATOR_NONE , test_ttc[l_count - 1U]);
+    TEST_ASSERT(test_speed[l_count - 1U] < 5);
+}
+
+/* Jitter around a standing obstacle never raises a time-to-collision warning */
+static void test_stationary_no_false_alarm(void){
+    ttc_estimator_t l_estimator;
+    uint8 l_index = 0;
+    uint16 l_min_ttc = TTC_ESTIMATOR_NONE;
+    test_replay(&l_estimator , test_profile_stationary , TEST_COUNT(test_profile_stationary));
+    for(l_index = 0 ; l_index < TEST_COUNT(test_profile_stationary) ; l_index++){
+        if(test_ttc[l_index] < l_min_ttc){
+            l_min_ttc = test_ttc[l_index];
+        }
+        else{ /* Nothing */ }
+    }
+    printf("    shortest time-to-collision %u ms\n" , l_min_ttc);
+    TEST_ASSERT(l_min_ttc > 3500U);
+}
+
+static void test_receding_no_ttc(void){
+    ttc_estimator_t l_estimator;
+    uint8 l_index = 0;
+    uint8 l_none = 1;
+    test_replay(&l_estimator , test_profile_receding , TEST_COUNT(test_profile_receding));
+    for(l_index = TEST_SETTLE_SAMPLES ; l_index < TEST_COUNT(test_profile_receding) ; l_index++){
+        if(TTC_ESTIMATOR_NONE != test_ttc[l_index]){
+            l_none = 0;
+        }
+        else{ /* Nothing */ }
+    }
+    TEST_ASSERT_EQUAL(1 , l_none);
+    TEST_ASSERT(test_speed[TEST_COUNT(test_profile_receding) - 1U] < -45);
+}
+
+/* 400 cm/s : the 1 s time-to-collision is reported while the obstacle is still about 4 m away ,
+   far before the 15 cm critical distance */
+static void test_fast_approach_warns_early(void){
+    ttc_estimator_t l_estimator;
+    uint8 l_index = 0;
+    uint16 l_distance_at_alarm = 0;
+    test_replay(&l_estimator , test_profile_fast , TEST_COUNT(test_profile_fast));
+    for(l_index = 0 ; (l_index < TEST_COUNT(test_profile_fast)) && (0U == l_distance_at_alarm) ; l_index++){
+        if(test_ttc[l_index] <= 1000U){
+            l_distance_at_alarm = test_profile_fast[l_index];
+        }
+        else{ /* Nothing */ }
+    }
+    printf("    1 s time-to-collision first reported at %u cm\n" , l_distance_at_alarm);
+    TEST_ASSERT(l_distance_at_alarm >= 300U);
+    TEST_ASSERT(l_distance_at_alarm <= 450U);
+}
+
+/* A gap longer than TTC_ESTIMATOR_MAX_INTERVAL_MS or a distance out of range restarts the track */
+static void test_restart_conditions(void){
+    ttc_estimator_t l_estimator;
+    uint16 l_ttc = 0;
+    uint32 l_timestamp_us = 0;
+    test_replay(&l_estimator , test_profile_constant , 30U);
+    TEST_ASSERT(TTC_ESTIMATOR_NONE != test_ttc[29]);
+    /* Last frame of the replay , then a longer gap than accepted (the timebase wraps in between) */
+    l_timestamp_us = 0xFFFFFFFFUL - 400000UL;
+    l_timestamp_us += 29UL * TEST_FRAME_PERIOD_US;
+    l_timestamp_us += (TTC_ESTIMATOR_MAX_INTERVAL_MS + 50UL) * 1000UL;
+    (void)ttc_estimator_update(&l_estimator , 120U , l_timestamp_us , &l_ttc);
+    TEST_ASSERT_EQUAL(TTC_ESTIMATOR_NONE , l_ttc);
+    test_replay(&l_estimator , test_profile_constant , 30U);
+    (void)ttc_estimator_update(&l_estimator , TTC_ESTIMATOR_MAX_DISTANCE + 1U , 0 , &l_ttc);
+    TEST_ASSERT_EQUAL(TTC_ESTIMATOR_NONE , l_ttc);
+    TEST_ASSERT_EQUAL(0 , l_estimator.valid);
+}
+
+/* Receding fast near the end of the range : the tracked distance stays within the bound the
+   32-bit prediction relies on */
+static void test_distance_bounded(void){
+    ttc_estimator_t l_estimator;
+    uint16 l_ttc = 0;
+    uint32 l_timestamp_us = 0;
+    uint8 l_index = 0;
+    uint8 l_bounded = 1;
+    (void)ttc_estimator_reset(&l_estimator);
+    for(l_index = 0 ; l_index < 40U ; l_index++){
+        /* 1000 cm/s away , then pinned at the range limit */
+        (void)ttc_estimator_update(&l_estimator , (uint16)((l_index < 20U) ? (800U + (l_index * 10U)) : TTC_ESTIMATOR_MAX_DISTANCE) ,
+                                   l_timestamp_us , &l_ttc);
+        if(l_estimator.distance_q8 > ((sint32)TTC_ESTIMATOR_MAX_DISTANCE * 256L)){
+            l_bounded = 0;
+        }
+        else{ /* Nothing */ }
+        l_timestamp_us += 10000UL;
+    }
+    TEST_ASSERT_EQUAL(1 , l_bounded);
+}
+
+int main(void){
+    TEST_RUN(test_constant_approach);
+    TEST_RUN(test_braking_approach);
+    TEST_RUN(test_stationary_no_false_alarm);
+    TEST_RUN(test_receding_no_ttc);
+    TEST_RUN(test_fast_approach_warns_early);
+    TEST_RUN(test_restart_conditions);
+    TEST_RUN(test_distance_bounded);
+    return TEST_REPORT();
+}